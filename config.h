@@ -1,30 +1,188 @@
 static char *config_shell = "/bin/sh";
 
+/* Read the pty in a separate thread, so that reads overlap with drawing */
+static int reader_thread = 0;
+
+/* Number of lines kept in history */
+static int history_size = 10000;
+
+/* Keep the lines pushed out of history in an unlinked temporary file
+ * (in $TMPDIR), so that history is unlimited without growing in memory */
+static int history_spill = 1;
+
+/* Lines scrolled through history by a wheel tick */
+static int scroll_lines = 3;
+
+/* History rows kept rendered on the X server, so that scrolling back
+ * over them doesn't draw them again (core X drawing only) */
+static int row_cache = 128;
+
+/* Jump scroll: while output floods in, parse it for up to this many ms
+ * between frames, and only draw the latest screen */
+static int parse_time = 15;
+
+/* Cursor style, as set by DECSCUSR: 1 blinking block, 2 block,
+ * 3 blinking underline, 4 underline, 5 blinking bar, 6 bar */
+static int cursor_style = 1;
+
+/* Cursor blink period (ms), and time after the last input or output
+ * after which the cursor stops blinking */
+static int blink_time = 600;
+static int blink_idle = 10000;
+
+/* Time (ms) a hidden window keeps its drawing buffer on the X server */
+static int release_time = 5000;
+
+/* Longest time (ms) drawing is held by synchronized output (mode 2026) */
+static int sync_timeout = 150;
+
+/* Rasterize glyphs into a shared memory image (MIT-SHM) instead of
+ * drawing with core X requests, where the server allows it */
+static int shm_render = 1;
+
+/* OSC 52: longest selection (bytes) programs may set, 0 to refuse them,
+ * and whether they may read back the selection this window holds */
+static int osc52_max = 1 << 20;
+static int osc52_read = 0;
+
+/* Pixels between split panes, and their color [0-15] */
+static int pane_gap = 1;
+static int pane_color = 8;
+
+/* Command the history and screen are exported to (on its standard input),
+ * and the file they are written to instead, if set */
+static char *export_cmd[] = { "/bin/sh", "-c",
+	"cat > \"$HOME/term-$(date +%Y%m%d-%H%M%S).txt\"", NULL };
+static char *export_file = NULL;
+
 static Shortcut shortcuts[] = {
 	{ ShiftMask,				XK_Insert,	sc_paste_sel },
 	{ ControlMask|ShiftMask,	XK_Insert,	sc_paste_clip },
 	{ ControlMask|ShiftMask,	XK_C,		sc_copy_clip },
 	{ ControlMask|ShiftMask,	XK_V,		sc_paste_clip },
+	{ ControlMask|ShiftMask,	XK_U,		sc_hint_copy },
+	{ ControlMask|ShiftMask,	XK_O,		sc_hint_pipe },
+	{ ShiftMask,				XK_Prior,	sc_scroll_up },
+	{ ShiftMask,				XK_Next,	sc_scroll_down },
+	{ ControlMask|ShiftMask,	XK_E,		sc_export },
+	{ ControlMask|ShiftMask,	XK_R,		sc_export_sgr },
+	{ ControlMask|ShiftMask,	XK_T,		sc_tab_new },
+	{ ControlMask|ShiftMask,	XK_Prior,	sc_tab_prev },
+	{ ControlMask|ShiftMask,	XK_Next,	sc_tab_next },
+	{ ControlMask|ShiftMask,	XK_bar,		sc_split_right },
+	{ ControlMask|ShiftMask,	XK_underscore,	sc_split_down },
+	{ ControlMask|ShiftMask,	XK_Left,	sc_pane_left },
+	{ ControlMask|ShiftMask,	XK_Right,	sc_pane_right },
+	{ ControlMask|ShiftMask,	XK_Up,		sc_pane_up },
+	{ ControlMask|ShiftMask,	XK_Down,	sc_pane_down },
+};
+
+/*
+ * Sequences sent for function keys, indexed by keysym. Modifiers are
+ * added as a parameter, as xterm does. Keys left out send their text.
+ */
+static Key keys[256] = {
+	/* keysym				sequence		application sequence and mode */
+	[KEY(XK_BackSpace)]		= { "\177" },
+	[KEY(XK_Up)]			= { "\033[A",	"\033OA",	MODE_APPCURSOR },
+	[KEY(XK_Down)]			= { "\033[B",	"\033OB",	MODE_APPCURSOR },
+	[KEY(XK_Right)]			= { "\033[C",	"\033OC",	MODE_APPCURSOR },
+	[KEY(XK_Left)]			= { "\033[D",	"\033OD",	MODE_APPCURSOR },
+	[KEY(XK_Home)]			= { "\033[H",	"\033OH",	MODE_APPCURSOR },
+	[KEY(XK_End)]			= { "\033[F",	"\033OF",	MODE_APPCURSOR },
+	[KEY(XK_Insert)]		= { "\033[2~" },
+	[KEY(XK_Delete)]		= { "\033[3~" },
+	[KEY(XK_Prior)]			= { "\033[5~" },
+	[KEY(XK_Next)]			= { "\033[6~" },
+	[KEY(XK_F1)]			= { "\033OP" },
+	[KEY(XK_F2)]			= { "\033OQ" },
+	[KEY(XK_F3)]			= { "\033OR" },
+	[KEY(XK_F4)]			= { "\033OS" },
+	[KEY(XK_F5)]			= { "\033[15~" },
+	[KEY(XK_F6)]			= { "\033[17~" },
+	[KEY(XK_F7)]			= { "\033[18~" },
+	[KEY(XK_F8)]			= { "\033[19~" },
+	[KEY(XK_F9)]			= { "\033[20~" },
+	[KEY(XK_F10)]			= { "\033[21~" },
+	[KEY(XK_F11)]			= { "\033[23~" },
+	[KEY(XK_F12)]			= { "\033[24~" },
+
+	/* Keypad, without Num Lock */
+	[KEY(XK_KP_Up)]			= { "\033[A",	"\033OA",	MODE_APPCURSOR },
+	[KEY(XK_KP_Down)]		= { "\033[B",	"\033OB",	MODE_APPCURSOR },
+	[KEY(XK_KP_Right)]		= { "\033[C",	"\033OC",	MODE_APPCURSOR },
+	[KEY(XK_KP_Left)]		= { "\033[D",	"\033OD",	MODE_APPCURSOR },
+	[KEY(XK_KP_Home)]		= { "\033[H",	"\033OH",	MODE_APPCURSOR },
+	[KEY(XK_KP_End)]		= { "\033[F",	"\033OF",	MODE_APPCURSOR },
+	[KEY(XK_KP_Begin)]		= { "\033[E",	"\033OE",	MODE_APPCURSOR },
+	[KEY(XK_KP_Insert)]		= { "\033[2~" },
+	[KEY(XK_KP_Delete)]		= { "\033[3~" },
+	[KEY(XK_KP_Prior)]		= { "\033[5~" },
+	[KEY(XK_KP_Next)]		= { "\033[6~" },
+	[KEY(XK_KP_F1)]			= { "\033OP" },
+	[KEY(XK_KP_F2)]			= { "\033OQ" },
+	[KEY(XK_KP_F3)]			= { "\033OR" },
+	[KEY(XK_KP_F4)]			= { "\033OS" },
+
+	/* Keypad, in application keypad mode (DECKPAM) */
+	[KEY(XK_KP_Enter)]		= { NULL,	"\033OM",	MODE_APPKEYPAD },
+	[KEY(XK_KP_Multiply)]	= { NULL,	"\033Oj",	MODE_APPKEYPAD },
+	[KEY(XK_KP_Add)]		= { NULL,	"\033Ok",	MODE_APPKEYPAD },
+	[KEY(XK_KP_Separator)]	= { NULL,	"\033Ol",	MODE_APPKEYPAD },
+	[KEY(XK_KP_Subtract)]	= { NULL,	"\033Om",	MODE_APPKEYPAD },
+	[KEY(XK_KP_Decimal)]	= { NULL,	"\033On",	MODE_APPKEYPAD },
+	[KEY(XK_KP_Divide)]		= { NULL,	"\033Oo",	MODE_APPKEYPAD },
+	[KEY(XK_KP_0)]			= { NULL,	"\033Op",	MODE_APPKEYPAD },
+	[KEY(XK_KP_1)]			= { NULL,	"\033Oq",	MODE_APPKEYPAD },
+	[KEY(XK_KP_2)]			= { NULL,	"\033Or",	MODE_APPKEYPAD },
+	[KEY(XK_KP_3)]			= { NULL,	"\033Os",	MODE_APPKEYPAD },
+	[KEY(XK_KP_4)]			= { NULL,	"\033Ot",	MODE_APPKEYPAD },
+	[KEY(XK_KP_5)]			= { NULL,	"\033Ou",	MODE_APPKEYPAD },
+	[KEY(XK_KP_6)]			= { NULL,	"\033Ov",	MODE_APPKEYPAD },
+	[KEY(XK_KP_7)]			= { NULL,	"\033Ow",	MODE_APPKEYPAD },
+	[KEY(XK_KP_8)]			= { NULL,	"\033Ox",	MODE_APPKEYPAD },
+	[KEY(XK_KP_9)]			= { NULL,	"\033Oy",	MODE_APPKEYPAD },
 };
 
+/* Hint mode: patterns labelled on screen, earlier ones take precedence */
+static char *hint_patterns[] = {
+	/* URLs */
+	"[a-zA-Z][a-zA-Z0-9+.-]*://[^] \t<>\"'(){}]+",
+	/* File paths */
+	"~?[a-zA-Z0-9_.+-]*(/[a-zA-Z0-9_.+-]+)+/?",
+	/* Git SHAs */
+	"\\<[0-9a-f]{7,40}\\>",
+};
+
+/* Characters used for hint labels */
+static char *hint_chars = "asdfghjkl";
+
+/* Command the chosen hint is piped to (on its standard input) */
+static char *hint_cmd[] = { "/bin/sh", "-c", "xdg-open \"$(cat)\"", NULL };
+
+/* Background color of hint labels */
+static int hint_color = 3;
+
+/* Colors [0-15], given as "#rrggbb" so that they are parsed
+ * without a round-trip to the X server */
 static char *color_names[] = {
-	"black",
-	"red3",
-	"green3",
-	"yellow3",
-	"blue3",
-	"magenta3",
-	"cyan3",
-	"gray90",
-
-	"gray30",
-	"red",
-	"green",
-	"yellow",
-	"blue",
-	"magenta",
-	"cyan",
-	"white",
+	"#000000",	/* black */
+	"#cd0000",	/* red3 */
+	"#00cd00",	/* green3 */
+	"#cdcd00",	/* yellow3 */
+	"#0000cd",	/* blue3 */
+	"#cd00cd",	/* magenta3 */
+	"#00cdcd",	/* cyan3 */
+	"#e5e5e5",	/* gray90 */
+
+	"#4d4d4d",	/* gray30 */
+	"#ff0000",	/* red */
+	"#00ff00",	/* green */
+	"#ffff00",	/* yellow */
+	"#0000ff",	/* blue */
+	"#ff00ff",	/* magenta */
+	"#00ffff",	/* cyan */
+	"#ffffff",	/* white */
 };
 
 int color_fg = 7;
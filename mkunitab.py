@@ -0,0 +1,246 @@
+#!/usr/bin/env python3
+#
+# Generate unitab.h: two-level tables of the width, grapheme cluster
+# break property and canonical combining class of every code point.
+#
+# usage: mkunitab.py [ucd-dir] > unitab.h
+#
+# EastAsianWidth.txt, GraphemeBreakProperty.txt and emoji-data.txt are
+# read from ucd-dir where present. Otherwise the properties are derived
+# from the Unicode database bundled with Python. Both must be of
+# UNICODE_VERSION, so that every host generates the same tables.
+
+import os
+import re
+import sys
+import unicodedata
+
+UNICODE_VERSION = "14.0.0"
+
+NCODES = 0x110000
+
+# Grapheme cluster break values (UAX #29), in the order of the C enum
+GB = ["Other", "CR", "LF", "Control", "Extend", "ZWJ", "Regional_Indicator",
+      "Prepend", "SpacingMark", "L", "V", "T", "LV", "LVT"]
+
+# Prepended concatenation marks: Prepend, and spacing
+PREPEND = [(0x0600, 0x0605), (0x06DD, 0x06DD), (0x070F, 0x070F),
+           (0x0890, 0x0891), (0x08E2, 0x08E2), (0x110BD, 0x110BD),
+           (0x110CD, 0x110CD)]
+
+# Blocks whose unassigned code points default to wide
+WIDE_DEFAULT = [(0x3400, 0x4DBF), (0x4E00, 0x9FFF), (0xF900, 0xFAFF),
+                (0x20000, 0x2FFFD), (0x30000, 0x3FFFD)]
+
+# Extended_Pictographic, for when emoji-data.txt is missing
+EXTPICT = [(0x00A9, 0x00A9), (0x00AE, 0x00AE), (0x203C, 0x203C),
+           (0x2049, 0x2049), (0x2122, 0x2122), (0x2139, 0x2139),
+           (0x2194, 0x2199), (0x21A9, 0x21AA), (0x231A, 0x231B),
+           (0x2328, 0x2328), (0x2388, 0x2388), (0x23CF, 0x23CF),
+           (0x23E9, 0x23F3), (0x23F8, 0x23FA), (0x24C2, 0x24C2),
+           (0x25AA, 0x25AB), (0x25B6, 0x25B6), (0x25C0, 0x25C0),
+           (0x25FB, 0x25FE), (0x2600, 0x2605), (0x2607, 0x2612),
+           (0x2614, 0x2685), (0x2690, 0x2705), (0x2708, 0x2712),
+           (0x2714, 0x2714), (0x2716, 0x2716), (0x271D, 0x271D),
+           (0x2721, 0x2721), (0x2728, 0x2728), (0x2733, 0x2734),
+           (0x2744, 0x2744), (0x2747, 0x2747), (0x274C, 0x274C),
+           (0x274E, 0x274E), (0x2753, 0x2755), (0x2757, 0x2757),
+           (0x2763, 0x2767), (0x2795, 0x2797), (0x27A1, 0x27A1),
+           (0x27B0, 0x27B0), (0x27BF, 0x27BF), (0x2934, 0x2935),
+           (0x2B05, 0x2B07), (0x2B1B, 0x2B1C), (0x2B50, 0x2B50),
+           (0x2B55, 0x2B55), (0x3030, 0x3030), (0x303D, 0x303D),
+           (0x3297, 0x3297), (0x3299, 0x3299), (0x1F000, 0x1F0FF),
+           (0x1F10D, 0x1F10F), (0x1F12F, 0x1F12F), (0x1F16C, 0x1F171),
+           (0x1F17E, 0x1F17F), (0x1F18E, 0x1F18E), (0x1F191, 0x1F19A),
+           (0x1F1AD, 0x1F1E5), (0x1F201, 0x1F20F), (0x1F21A, 0x1F21A),
+           (0x1F22F, 0x1F22F), (0x1F232, 0x1F23A), (0x1F23C, 0x1F23F),
+           (0x1F249, 0x1F3FA), (0x1F400, 0x1F53D), (0x1F546, 0x1F64F),
+           (0x1F680, 0x1F6FF), (0x1F774, 0x1F77F), (0x1F7D5, 0x1F7FF),
+           (0x1F80C, 0x1F80F), (0x1F848, 0x1F84F), (0x1F85A, 0x1F85F),
+           (0x1F888, 0x1F88F), (0x1F8AE, 0x1F8FF), (0x1F90C, 0x1F93A),
+           (0x1F93C, 0x1F945), (0x1F947, 0x1FAFF), (0x1FC00, 0x1FFFD)]
+
+
+def check_version(path):
+    """Fail unless the UCD file is of UNICODE_VERSION."""
+    with open(path, encoding="utf-8") as f:
+        head = "".join(f.readline() for _ in range(10))
+    m = (re.search(r"-(\d+\.\d+\.\d+)\.txt", head)
+         or re.search(r"Version:? (\d+\.\d+(?:\.\d+)?)", head))
+    version = m.group(1) if m else "unknown"
+    if not UNICODE_VERSION.startswith(version):
+        sys.exit("%s: Unicode %s, expected %s" % (path, version, UNICODE_VERSION))
+
+
+def ranges(path):
+    """Yield (first, last, value) of the lines of a UCD file."""
+    check_version(path)
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            line = line.split("#", 1)[0].strip()
+            if not line:
+                continue
+            codes, value = [s.strip() for s in line.split(";")[:2]]
+            first, _, last = codes.partition("..")
+            yield int(first, 16), int(last or first, 16), value
+
+
+def fill(table, rs, value):
+    for first, last in rs:
+        for c in range(first, last + 1):
+            table[c] = value
+
+
+def east_asian_width(ucd):
+    path = os.path.join(ucd, "EastAsianWidth.txt")
+    if os.path.exists(path):
+        eaw = ["N"] * NCODES
+        fill(eaw, WIDE_DEFAULT, "W")
+        for first, last, value in ranges(path):
+            for c in range(first, last + 1):
+                eaw[c] = value
+        return eaw
+    eaw = [unicodedata.east_asian_width(chr(c)) for c in range(NCODES)]
+    for first, last in WIDE_DEFAULT:
+        for c in range(first, last + 1):
+            if unicodedata.category(chr(c)) == "Cn":
+                eaw[c] = "W"
+    return eaw
+
+
+def hangul(c):
+    if 0x1100 <= c <= 0x115F or 0xA960 <= c <= 0xA97C:
+        return "L"
+    if 0x1160 <= c <= 0x11A7 or 0xD7B0 <= c <= 0xD7C6:
+        return "V"
+    if 0x11A8 <= c <= 0x11FF or 0xD7CB <= c <= 0xD7FB:
+        return "T"
+    if 0xAC00 <= c <= 0xD7A3:
+        return "LV" if (c - 0xAC00) % 28 == 0 else "LVT"
+    return None
+
+
+def grapheme_break(ucd):
+    path = os.path.join(ucd, "GraphemeBreakProperty.txt")
+    gb = ["Other"] * NCODES
+    if os.path.exists(path):
+        for first, last, value in ranges(path):
+            for c in range(first, last + 1):
+                gb[c] = value
+        return gb
+
+    for c in range(NCODES):
+        cat = unicodedata.category(chr(c))
+        if cat in ("Cc", "Zl", "Zp") or (cat == "Cf" and c != 0x200C):
+            gb[c] = "Control"
+        elif cat in ("Mn", "Me"):
+            gb[c] = "Extend"
+        elif cat == "Mc":
+            gb[c] = "SpacingMark"
+        else:
+            gb[c] = hangul(c) or "Other"
+    gb[0x0D] = "CR"
+    gb[0x0A] = "LF"
+    gb[0x200D] = "ZWJ"
+    fill(gb, [(0x200C, 0x200C), (0xFF9E, 0xFF9F), (0x1F3FB, 0x1F3FF),
+              (0xE0020, 0xE007F)], "Extend")
+    fill(gb, [(0x0E33, 0x0E33), (0x0EB3, 0x0EB3)], "SpacingMark")
+    fill(gb, [(0x1F1E6, 0x1F1FF)], "Regional_Indicator")
+    fill(gb, PREPEND, "Prepend")
+    return gb
+
+
+def extended_pictographic(ucd):
+    path = os.path.join(ucd, "emoji-data.txt")
+    ep = [False] * NCODES
+    if os.path.exists(path):
+        fill(ep, [(first, last) for first, last, value in ranges(path)
+                  if value == "Extended_Pictographic"], True)
+    else:
+        fill(ep, EXTPICT, True)
+    return ep
+
+
+def width(c, cat, eaw):
+    """Number of cells taken by a code point, as a terminal sees it."""
+    if c == 0x00AD or any(first <= c <= last for first, last in PREPEND):
+        return 1
+    if cat in ("Mn", "Me", "Cf", "Cc", "Zl", "Zp"):
+        return 0
+    # Hangul medial vowels and final consonants join the syllable
+    if hangul(c) in ("V", "T"):
+        return 0
+    # Variation selectors and other default ignorables
+    if 0xFE00 <= c <= 0xFE0F or 0xE0000 <= c <= 0xE0FFF or c == 0x200B:
+        return 0
+    return 2 if eaw in ("W", "F") else 1
+
+
+def main():
+    ucd = sys.argv[1] if len(sys.argv) > 1 else "/usr/share/unicode"
+    if unicodedata.unidata_version != UNICODE_VERSION:
+        sys.exit("python's Unicode database is %s, expected %s"
+                 % (unicodedata.unidata_version, UNICODE_VERSION))
+    eaw = east_asian_width(ucd)
+    gb = grapheme_break(ucd)
+    ep = extended_pictographic(ucd)
+
+    prop = []
+    for c in range(NCODES):
+        u = chr(c)
+        prop.append(width(c, unicodedata.category(u), eaw[c])
+                    | GB.index(gb[c]) << 2
+                    | ep[c] << 6
+                    | unicodedata.combining(u) << 7)
+
+    # Pick the block size giving the smallest tables
+    best = None
+    for shift in range(4, 11):
+        size = 1 << shift
+        blocks, index = {}, []
+        for b in range(0, NCODES, size):
+            block = tuple(prop[b:b + size])
+            if block not in blocks:
+                blocks[block] = len(blocks) * size
+            index.append(blocks[block])
+        if len(blocks) * size > 0xFFFF:
+            continue
+        total = 2 * len(index) + 2 * len(blocks) * size
+        if best is None or total < best[0]:
+            best = (total, shift, index, blocks)
+    total, shift, index, blocks = best
+
+    out = sys.stdout
+    out.write("/* Generated by mkunitab.py (Unicode %s), do not edit */\n\n"
+              % unicodedata.unidata_version)
+    out.write("/* Grapheme cluster break property (UAX #29) */\n")
+    out.write("enum grapheme_break {\n")
+    for name in GB:
+        out.write("\tGB_%s,\n" % name.upper())
+    out.write("};\n\n")
+    out.write("/* Fields of a code point's properties */\n")
+    out.write("#define UNI_WIDTH(p)\t\t((p) & 0x3)\n")
+    out.write("#define UNI_GB(p)\t\t\t((p) >> 2 & 0xf)\n")
+    out.write("#define UNI_EXTPICT(p)\t\t((p) >> 6 & 0x1)\n")
+    out.write("#define UNI_CCC(p)\t\t\t((p) >> 7 & 0xff)\n\n")
+    out.write("#define UNITAB_SHIFT\t\t%d\n\n" % shift)
+
+    def table(name, values):
+        out.write("static const unsigned short %s[%d] = {\n" % (name, len(values)))
+        for i in range(0, len(values), 12):
+            out.write("\t" + " ".join("%d," % v for v in values[i:i + 12]) + "\n")
+        out.write("};\n\n")
+
+    table("unitab_index", index)
+    table("unitab_prop", [v for block in blocks for v in block])
+
+    out.write("/*\n * Properties of a code point: two array loads.\n */\n")
+    out.write("static inline unsigned int uniprop(unsigned int r)\n{\n")
+    out.write("\tif (r >= 0x%x)\n\t\treturn 1;\n" % NCODES)
+    out.write("\treturn unitab_prop[unitab_index[r >> UNITAB_SHIFT] +\n"
+              "\t\t(r & ((1 << UNITAB_SHIFT) - 1))];\n}\n")
+    sys.stderr.write("unitab.h: %d bytes of tables, %d-bit blocks\n" % (total, shift))
+
+
+if __name__ == "__main__":
+    main()
@@ -1,3 +1,6 @@
+/* O_TMPFILE */
+#define _GNU_SOURCE
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -8,20 +11,43 @@
 #include <unistd.h>
 #include <pwd.h>
 #include <signal.h>
+#include <time.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdatomic.h>
 #include <sys/wait.h>
 #include <sys/ioctl.h>
 #include <sys/types.h>
-#include <sys/select.h>
+#include <sys/epoll.h>
+#include <sys/signalfd.h>
+#include <sys/timerfd.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <sys/eventfd.h>
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <regex.h>
 #include <X11/Xlib.h>
 #include <X11/Xutil.h>
 #include <X11/Xatom.h>
 #include <X11/keysym.h>
 #include <X11/Xresource.h>
+#include <X11/extensions/XShm.h>
 #include <pty.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 #include "term.h"
+#include "unitab.h"
 
 static char *argv0;
+extern char **environ;
 
 /* Macros */
 #define DEBUG(msg, ...) \
@@ -37,6 +63,18 @@ static char *argv0;
 #define DEFAULT(a, b)	((a) ? (a) : (b))
 #define LEN(a)			(sizeof(a) / sizeof(a)[0])
 #define MODBIT(x, set, bit) ((set) ? ((x) |= (bit)) : ((x) &= ~(bit)))
+#define TIMEDIFF(t1, t2)	(((t1).tv_sec - (t2).tv_sec) * 1000.0 + \
+			((t1).tv_nsec - (t2).tv_nsec) / 1E6)
+#define BETWEEN(x, a, b)	((a) <= (x) && (x) <= (b))
+#define KEY(k)			((k) & 0xff)	/* index in keys[] of a function keysym */
+#define ISCONTROL(c)	((uchar)(c) < 0x20 || (c) == 0x7f)
+
+/* 24-bit colors are stored above the 256 color palette */
+#define TRUECOLOR(r, g, b)	(1 << 24 | (r) << 16 | (g) << 8 | (b))
+#define IS_TRUECOLOR(x)		((x) & 1 << 24)
+#define TRUERED(x)			(((x) >> 16) & 0xff)
+#define TRUEGREEN(x)		(((x) >> 8) & 0xff)
+#define TRUEBLUE(x)			((x) & 0xff)
 
 #define RES_NAME		"term"
 #define RES_CLASS		"Term"
@@ -51,6 +89,41 @@ static char *argv0;
 
 #define XK_ANY_MOD	UINT_MAX
 
+#define RING_SIZ		(1 << 16)
+#define TRACE_MAX		(1 << 22)	/* events kept by -T, the rest are dropped */
+#define PARSE_BUDGET	(1 << 14)	/* bytes parsed between checks of parse_time */
+#define EXPORT_BUF		(1 << 16)	/* lines of an export are encoded this much at once */
+#define EXPORT_BUDGET	(1 << 20)	/* bytes exported before main_loop() goes on */
+#define SGR_SIZ			48			/* longest SGR sequence of a style */
+
+#define CSI_BUF_SIZ		256
+#define CSI_ARG_SIZ		16
+#define OSC_ARG_SIZ		16
+
+#define UTF_SIZ			4
+#define UTF_INVALID		0xfffd
+#define WIDE_TAIL		0		/* cell covered by a wide character */
+
+/* Cells of grapheme clusters refer to the cluster table of Term */
+#define CLUSTER_BIT		(1u << 31)
+#define IS_CLUSTER(r)	((r) & CLUSTER_BIT)
+#define CLUSTER_MAX		8		/* code points kept per cluster */
+
+#define STYLE_MAX		(USHRT_MAX + 1)
+#define STYLE_RESERVE	4096	/* styles left to palette colors */
+#define CELL_SIZE		((long)(sizeof(Rune) + sizeof(ushort)))	/* memory of a cell */
+#define SPILL_CACHE		256		/* spilled rows kept decoded */
+#define SPILL_MAP_STEP	(1 << 20)	/* granularity of spill file mappings */
+#define SC_HASH_SIZ		64		/* slots of the shortcut hash */
+#define REQUEST_TIME	1000	/* ms termc has to send its request */
+
+/* Events selected on every pane, pointer motion being added for mouse modes.
+ * Keys and focus go to the frame, which passes them to its active pane. */
+#define EVENT_MASK		(ExposureMask | ButtonPressMask | ButtonReleaseMask | \
+		StructureNotifyMask | VisibilityChangeMask)
+#define FRAME_MASK		(ExposureMask | KeyPressMask | StructureNotifyMask | \
+		FocusChangeMask)
+
 /* Enums */
 enum window_state {
 	WIN_VISIBLE	= 1 << 0,
@@ -58,17 +131,97 @@ enum window_state {
 	WIN_REDRAW	= 1 << 2,
 };
 
+enum char_attr {
+	ATTR_BOLD		= 1 << 0,
+	ATTR_UNDERLINE	= 1 << 1,
+	ATTR_REVERSE	= 1 << 2,
+};
+
+enum term_mode {
+	MODE_SYNC		= 1 << 0,	/* synchronized output: drawing is held */
+	MODE_HIDE		= 1 << 1,	/* cursor is hidden (DECTCEM reset) */
+	MODE_APPCURSOR	= 1 << 2,	/* application cursor keys (DECCKM) */
+	MODE_APPKEYPAD	= 1 << 3,	/* application keypad (DECKPAM) */
+	MODE_MOUSEBTN	= 1 << 4,	/* report mouse buttons (1000) */
+	MODE_MOUSEDRAG	= 1 << 5,	/* and motion with a button held (1002) */
+	MODE_MOUSEMOTION	= 1 << 6,	/* and all motion (1003) */
+	MODE_MOUSESGR	= 1 << 7,	/* SGR encoding of mouse reports (1006) */
+	MODE_MOUSE		= MODE_MOUSEBTN | MODE_MOUSEDRAG | MODE_MOUSEMOTION,
+};
+
+enum cursor_shape {
+	CURSOR_NONE,		/* not drawn: hidden, or blinked off */
+	CURSOR_BLOCK,
+	CURSOR_UNDERLINE,
+	CURSOR_BAR,
+	CURSOR_HOLLOW,		/* block outline, when the window is unfocused */
+};
+
+enum esc_state {
+	ESC_NONE,		/* not in an escape sequence */
+	ESC_START,		/* ESC received */
+	ESC_CSI,		/* ESC [ received */
+	ESC_OSC,		/* ESC ] received */
+};
+
+/* Subsystems memory is accounted to */
+enum mem_tag {
+	MEM_SCREEN,		/* screen lines, clusters and styles */
+	MEM_HISTORY,	/* lines of history */
+	MEM_SPILL,		/* buffers and decoded rows of the history spill */
+	MEM_SPILLMAP,	/* mappings of the spill files */
+	MEM_SELECTION,	/* text of the selections */
+	MEM_HINTS,		/* hint pattern matches */
+	MEM_PARSER,		/* pty ring, OSC and export buffers */
+	MEM_FONTS,		/* metrics of the fonts, as held by Xlib */
+	MEM_GLYPHS,		/* glyph atlas and row cache index */
+	MEM_PIXMAPS,	/* pixmaps, as held by the X server (estimate) */
+	MEM_SHM,		/* shared memory images */
+	MEM_LAST,
+};
+
+enum osc_state {
+	OSC_ARG,		/* reading the command number and selections */
+	OSC_DATA,		/* decoding the base64 data of OSC 52 */
+	OSC_QUERY,		/* the data of OSC 52 is ? */
+	OSC_IGNORE,		/* unsupported or too long: skipped to its end */
+};
+
 /* Typedefs for types */
 typedef unsigned char uchar;
 typedef unsigned int uint;
 typedef unsigned long ulong;
 typedef unsigned short ushort;
+typedef uint32_t Rune;
 
 /* Structs */
+
+/*
+ * Single-producer/single-consumer ring, filled from the pty by a reader
+ * thread and drained by the main thread. head and tail only grow, and
+ * head - tail is the number of buffered bytes.
+ */
+typedef struct {
+	_Alignas(64) atomic_size_t head;	/* written by the reader thread only */
+	_Alignas(64) atomic_size_t tail;	/* written by the main thread only */
+	atomic_int notified;	/* reader has signalled datafd */
+	atomic_int waiting;		/* reader is blocked until spacefd is signalled */
+	atomic_int hangup;		/* reader stopped: the pty hung up */
+	int fd;					/* pty master */
+	int datafd;				/* eventfd: data available */
+	int spacefd;			/* eventfd: space available */
+	pthread_t thread;		/* reader thread */
+	char buf[RING_SIZ];
+} Ring;
+
 typedef struct {
 	pid_t pid;			/* PID of slave pty */
 	int fd;				/* fd of process running in pty */
 	struct winsize ws;	/* window size struct (for openpty and ioctl) */
+	Ring *ring;			/* ring of the reader thread, if used */
+	char **cmd;			/* command to run instead of the shell */
+	char *cwd;			/* working directory of command */
+	char **env;			/* environment of command */
 } TTY;
 
 typedef struct {
@@ -76,20 +229,233 @@ typedef struct {
 	int y;
 } Coord;
 
+/* Colors and attributes of a character */
+typedef struct {
+	uint fg;		/* foreground: palette index or TRUECOLOR() */
+	uint bg;		/* background: palette index or TRUECOLOR() */
+	ushort attr;	/* attribute bits (enum char_attr) */
+} Style;
+
+/* Interned style: cells refer to it by its index in the style table */
+typedef struct {
+	Style style;
+	int refs;		/* number of references, 0 if free */
+	int next;		/* next style of hash chain, or next free style */
+} StyleEntry;
+
+/* CSI escape sequence: ESC [ [?>] [arg1[;arg2...]] mode */
+typedef struct {
+	char buf[CSI_BUF_SIZ];	/* raw sequence, without ESC [ */
+	int len;				/* length of buf */
+	char priv;				/* private marker ('?' or '>'), or 0 */
+	char inter;				/* intermediate character ('$'), or 0 */
+	int arg[CSI_ARG_SIZ];	/* numeric arguments */
+	int narg;				/* number of arguments */
+	char mode;				/* final character */
+} CSIEscape;
+
+/*
+ * OSC sequence: ESC ] Ps ; Pt, ended by BEL or ST (ESC \). Only
+ * OSC 52 (Ps ; Pc ; base64) is handled. Its data is decoded as it
+ * arrives, into the buffer that becomes the selection.
+ */
+typedef struct {
+	int state;				/* enum osc_state */
+	char arg[OSC_ARG_SIZ];	/* Ps ; Pc, read so far */
+	int arglen;				/* length of arg */
+	char *data;				/* decoded data */
+	size_t len;				/* bytes in data */
+	size_t size;			/* size of data */
+	uint32_t quad;			/* base64 characters held over, 6 bits each */
+	int nquad;				/* number of them */
+} OSCEscape;
+
+/* Grapheme cluster of several code points, shared by reference */
+typedef struct {
+	Rune r[CLUSTER_MAX];	/* code points, base character first */
+	int n;					/* number of code points */
+	int refs;				/* number of cells referring to it, 0 if free */
+	int next;				/* next free cluster */
+} Cluster;
+
+/* Line scrolled off the top of the screen */
+typedef struct {
+	Rune *line;		/* characters */
+	ushort *style;	/* styles of characters */
+	int len;		/* number of cells */
+} HistLine;
+
+/*
+ * Row spilled to disk, followed by nruns SpillRun and then the code
+ * points of its cells. Code points after the first of a cluster have
+ * CLUSTER_BIT set.
+ */
+typedef struct {
+	uint32_t len;		/* number of cells */
+	uint32_t nruns;		/* number of style runs */
+	uint32_t nrunes;	/* number of code points */
+} SpillRow;
+
+/* Cells of a spilled row sharing a style */
+typedef struct {
+	uint32_t n;			/* number of cells */
+	Style style;
+} SpillRun;
+
+/* File written by appending, and read through a mapping */
+typedef struct {
+	int fd;
+	uint64_t size;		/* bytes written */
+	uchar *map;			/* mapping, or NULL */
+	size_t maplen;		/* length of map */
+} SpillFile;
+
+/*
+ * Lines pushed out of history, spilled to unlinked temporary files.
+ * Row n is the nth oldest.
+ */
+typedef struct {
+	SpillFile data;		/* rows, in the SpillRow format */
+	SpillFile index;	/* offset in data of each row (uint64_t) */
+	long n;				/* number of rows */
+	uchar *buf;			/* buffer rows are encoded in */
+	size_t bufsize;		/* size of buf */
+	HistLine rows[SPILL_CACHE];	/* decoded rows, by number modulo SPILL_CACHE */
+	long rowno[SPILL_CACHE];	/* number of each decoded row, -1 if none */
+} Spill;
+
+/*
+ * Lines of the screen and history being written to export_cmd or
+ * export_file. Lines are numbered as by term_line(), so they are
+ * found again after the screen scrolls.
+ */
+typedef struct {
+	int fd;
+	Bool sgr;			/* keep colors and attributes, as SGR sequences */
+	Bool polled;		/* fd is watched by main_loop(), else always writable */
+	long next;			/* number of the next line to encode */
+	long end;			/* number of the line after the last one */
+	char *buf;			/* encoded lines */
+	size_t size;		/* size of buf */
+	size_t len;			/* bytes in buf */
+	size_t off;			/* bytes of buf written */
+} Export;
+
+/* Event of the -T trace: a span, a counter value or an instant */
+typedef struct {
+	const char *name;
+	char ph;			/* trace event phase: 'X', 'C' or 'i' */
+	const char *arg;	/* name of value, or NULL */
+	long value;
+	uint64_t ts;		/* start (us) */
+	uint64_t dur;		/* duration of a span (us) */
+} TraceEvent;
+
+/* Memory of a subsystem */
+typedef struct {
+	long cur;		/* bytes held */
+	long peak;		/* most bytes ever held */
+} MemStat;
+
+/* History row rendered into the row cache */
+typedef struct {
+	long line;		/* number of the history line, -1 if free */
+	ulong used;		/* cacheclock at its last use */
+} RowCache;
+
+/* Pattern match within a line */
+typedef struct {
+	int x;			/* column of first character */
+	int len;		/* length in characters */
+} Match;
+
+/* Pattern matches of a single line, kept up to date as lines change */
+typedef struct {
+	Match *match;	/* matches, ordered by column */
+	int n;			/* number of matches */
+	int size;		/* allocated size of match array */
+	Bool dirty;		/* line changed since it was last scanned */
+} LineMatch;
+
 /* Internal representation of screen */
 typedef struct {
 	int rows;		/* number of rows */
 	int cols;		/* number of columns */
 	Coord cursor;	/* position of cursor */
-	char **line;	/* lines */
+	int top;		/* first row of the scroll region (DECSTBM) */
+	int bot;		/* and its last row */
+	Bool wrapnext;	/* next character wraps to a new line */
+	int cursorstyle;	/* DECSCUSR style, 0 for cursor_style */
+	int modkeys;	/* xterm modifyOtherKeys level: 0, 1 or 2 */
+	int mode;		/* terminal modes (enum term_mode) */
+	struct timespec synctime;	/* when synchronized output was set */
+	Style pen;		/* style of printed characters */
+	ushort penidx;	/* index of pen in the style table */
+	int esc;		/* escape sequence state (enum esc_state) */
+	CSIEscape csi;	/* CSI sequence being parsed */
+	OSCEscape osc;	/* OSC sequence being parsed */
+	Rune utf8;		/* UTF-8 sequence being decoded */
+	int utf8len;	/* continuation bytes still expected */
+	Rune utf8min;	/* smallest code point of the sequence's length */
+	Rune **line;	/* lines */
+	Cluster *cluster;	/* grapheme clusters referred to by cells */
+	int ncluster;	/* allocated size of cluster */
+	int freecluster;	/* first free cluster, -1 if none */
+	ushort **style;	/* styles of characters in lines (style table indices) */
+	StyleEntry *styles;	/* style table, 0 is the default style */
+	int nstyles;	/* allocated size of styles */
+	int freestyle;	/* first free style, -1 if none */
+	int usedstyles;	/* number of styles in use */
+	Bool stylefull;	/* styles ran out, and it was reported */
+	int *stylehash;	/* first style of each hash chain, nstyles of them */
 	Bool *dirty;	/* dirtyness of lines */
+	uint64_t *drawn;	/* fingerprints of rows as last drawn, 0 if unknown */
+	LineMatch *lm;	/* hint pattern matches of lines */
+	HistLine *hist;	/* history, a ring of history_size lines */
+	int histlen;	/* number of lines in history */
+	int histtop;	/* index of the newest line in hist */
+	long histno;	/* number of lines ever pushed to history */
+	Spill *spill;	/* lines pushed out of hist, or NULL */
+	Bool nospill;	/* spill files failed: lines pushed out are dropped */
+	Export *export;	/* export in progress, or NULL */
+	int scroll;		/* lines the view is scrolled back into history */
 } Term;
 
+/* Hint mode state */
+typedef struct {
+	Bool active;		/* hint mode is active */
+	Bool pipe;			/* pipe chosen text to hint_cmd instead of copying */
+	int n;				/* number of labelled matches */
+	int labellen;		/* length of every label */
+	char input[8];		/* label characters typed so far */
+	int ninput;			/* number of characters in input */
+} Hint;
+
 /* Visual representation of screen */
 typedef struct {
 	Display *display;			/* X display */
 	Window win;					/* X window */
 	Drawable drawbuf;			/* drawing buffer */
+	XImage *shmimg;				/* shared memory drawing buffer, or NULL */
+	XShmSegmentInfo shminfo;	/* segment of shmimg */
+	int shmpending;				/* puts of shmimg not yet completed */
+	struct timespec hidetime;	/* when the window was last hidden */
+	Coord curdrawn;				/* cell the cursor was last drawn in */
+	int curshape;				/* shape it was drawn with (enum cursor_shape) */
+	struct timespec blinktime;	/* last input or output: blink restarts on */
+	Coord mousecell;			/* cell of the last mouse report */
+	Coord motioncell;			/* cell of the last pointer motion of a frame */
+	uint motionstate;			/* its modifier and button state */
+	Bool motionpending;			/* motion not reported yet */
+	Bool shifted;				/* rows of drawbuf were shifted: push them whole */
+	int shifttop, shiftbot;		/* first and last of them */
+	int scrolltop, scrollbot;	/* rows the screen scrolled in since the last frame */
+	int scrolln;				/* and by how much (down), 0 if it didn't */
+	long bufmem;				/* accounted memory of drawbuf or shmimg */
+	Pixmap cachepix;			/* row cache, row_cache rows high */
+	long cachemem;				/* accounted memory of cachepix */
+	RowCache *cache;			/* history rows held by cachepix */
+	ulong cacheclock;			/* use counter, for evicting rows */
 	Visual *visual;				/* default visual */
 	Colormap colormap;			/* default colormap */
 	XSetWindowAttributes attrs;	/* window attributes */
@@ -126,33 +492,194 @@ typedef struct {
 	void (*func)(XKeyEvent *xkey);
 } Shortcut;
 
+/* Sequences sent for a function key */
+typedef struct {
+	char *seq;			/* sequence, NULL to send the text of the key */
+	char *appseq;		/* sequence in application mode, or NULL */
+	int appmode;		/* that application mode (enum term_mode) */
+} Key;
+
 /* Drawing context */
 typedef struct {
 	GC gc;
 	XFont font;
 	XColor colors[256];
+	Bool truecolor;		/* pixels are computed from the visual's masks */
+	int shift[3];		/* shift of red, green and blue in a pixel */
+	int bits[3];		/* width of red, green and blue in a pixel */
+	int shmevent;		/* event type of ShmCompletion */
 } DC;
 
+/* Glyph of the atlas, outside ASCII */
+typedef struct {
+	Rune r;			/* character, 0 for an empty entry */
+	int slot;		/* first slot, -1 for a blank glyph */
+} Glyph;
+
+/* Glyph coverage for the shared memory renderer, in slots of one cell */
+typedef struct {
+	uchar *cov;		/* coverage of slots, one after another */
+	int nslots;		/* number of slots in use, ASCII first */
+	int size;		/* number of slots allocated */
+	Glyph *map;		/* hash map of glyphs outside ASCII */
+	int nmap;		/* number of glyphs in map */
+	int mapsize;	/* size of map, a power of two */
+	Pixmap scratch;	/* glyphs are rendered here */
+} Atlas;
+
 typedef struct {
 	XFont font;
 	char *colors[16];
+	char *geometry;
 } XResources;
 
+/* Panes of a tab: a single pane, or a split of two layouts */
+typedef struct Layout {
+	struct Win *pane;			/* pane, NULL for a split */
+	Bool stacked;				/* halves one above the other, else side by side */
+	struct Layout *half[2];		/* halves of a split, NULL for a pane */
+	struct Layout *parent;		/* split holding it, NULL for a whole tab */
+	int x, y, width, height;	/* area in the frame, as last laid out */
+} Layout;
+
+/*
+ * Top-level X window of one or more panes, in tabs. The panes of the
+ * current tab are tiled in it as child windows, each drawn by its own
+ * Win. A bar of the tabs is drawn above them when there are several.
+ */
+typedef struct Frame {
+	Window win;				/* X window */
+	int width, height;		/* its size */
+	Layout **tab;			/* panes of each tab */
+	int ntabs;				/* number of tabs */
+	int cur;				/* tab shown */
+	struct Win *active;		/* pane keys are typed into */
+	Bool focused;			/* frame has the input focus */
+	Bool mapped;			/* frame was mapped */
+	struct Frame *next;
+} Frame;
+
+/* termc request, kept while windows use its strings */
+typedef struct {
+	char *buf;			/* NUL terminated strings */
+	char **v;			/* the strings, the empty ones NULL */
+	int refs;			/* number of windows using it */
+} Request;
+
+/* termc client whose request is being read */
+typedef struct Client {
+	int fd;
+	char *buf;			/* request read so far */
+	size_t len, size;	/* its length, and room */
+	struct timespec start;	/* when it connected */
+	struct Client *next;
+} Client;
+
+/* Options of a single window */
+typedef struct {
+	char *geometry;		/* geometry string */
+	Window parent;		/* parent window */
+	char **cmd;			/* command to run instead of the shell */
+	char *cwd;			/* working directory of command */
+	char **env;			/* environment of command */
+	Frame *frame;		/* frame to open a pane in, NULL for a new one */
+	Layout *layout;		/* and the place of the pane in it */
+} WinOpts;
+
+/*
+ * Terminal window. termd serves several windows from one process;
+ * the state of the window being handled is loaded into the tty,
+ * term, xw, sel and hint globals by win_load(). Every window is a
+ * pane of a frame, which may hold others.
+ */
+typedef struct Win {
+	TTY tty;
+	Term term;
+	XWindow xw;
+	Selection sel;
+	Hint hint;
+	Frame *frame;		/* frame the window is a pane of */
+	Layout *layout;		/* its place in the frame */
+	Request *req;		/* termc request its options point into */
+	struct Win *next;
+} Win;
+
 /* Function prototypes */
 static ssize_t swrite(int fd, const void *buf, size_t count);
 static size_t sstrlen(const char *s);
+static int utf8_encode(Rune r, char *s);
+static int utf8_string(const Rune *r, int n, char *s);
 static void die(const char *fmt, ...);
 
 static void tty_read(void);
+static void tty_parse(const char *buf, int len);
+static int tty_pollfd(void);
+static Bool tty_pending(void);
+static void ring_new(int fd);
+static void *ring_reader(void *arg);
+static void ring_drain(void);
+static void ring_free(void);
 static void tty_write(const char *s, size_t len);
 static void tty_init(void);
 static void tty_resize(int cols, int rows);
 
 static void draw(void);
 static void draw_region(int col1, int row1, int col2, int row2);
+static void draw_run(int col, int row, Rune *s, int len, Style *style);
 static void redraw(void);
+static void draw_cells(int row, int col1, int col2);
+static int view_line(int row, Rune **line, ushort **style, long *id);
+static void view_scroll(int n);
+static Bool rowcache_load(int row);
+static void rowcache_store(int row);
+static void draw_cursor(void);
+static int cursor_shape(struct timespec *now);
+static double cursor_wait(struct timespec *now);
+static uint64_t draw_fingerprint(int row);
 
 static void term_putc(char c);
+static void term_putrune(Rune r);
+static Bool term_extends(Rune cell, Rune r);
+static const Rune *cell_runes(const Rune *cell, int *n);
+static void cell_set(Rune *cell, Rune r);
+static void cell_release(Rune *cell, int n);
+static Rune cluster_add(Rune cell, Rune r);
+static void style_grow(void);
+static ushort style_intern(Style *style);
+static void style_set(ushort *cell, ushort idx);
+static void style_release(ushort *cell, int n);
+static void term_setpen(void);
+static void csi_parse(void);
+static const char *osc_span(const char *s, const char *end);
+static void osc_put(const char *s, size_t n);
+static void osc_arg(char c);
+static void osc_decode(const char *s, size_t n);
+static void osc_end(char c);
+static void osc52_set(const char *pc);
+static void osc52_query(const char *pc, char c);
+static int b64_value(uchar c);
+static size_t b64_encode(const char *s, size_t n, char *out);
+static void csi_handle(void);
+static void term_setattr(int *arg, int narg);
+static void term_setmode(Bool priv, Bool set, int *arg, int narg);
+static void term_reportmode(Bool priv, int mode);
+static int sgr_color(int *arg, int narg, int *i);
+static void term_newline(void);
+static void term_scroll(int top, int bot, int n);
+static void array_rotate(void *a, size_t size, int len, int n);
+static void term_splitwide(int x, int y);
+static void term_insertblank(int n);
+static void term_deletechar(int n);
+static void term_erasechar(int n);
+static void term_histpush(int row);
+static long term_histcount(void);
+static int term_line(long n, Rune **line, ushort **style);
+static void spill_push(Rune *line, ushort *style, int len);
+static int spill_line(long n, Rune **line, ushort **style);
+static const void *spill_map(SpillFile *f, uint64_t off, size_t len);
+static int spill_write(SpillFile *f, const void *buf, size_t len);
+static void spill_stop(void);
+static void spill_free(void);
 static void term_moveto(int x, int y);
 static void term_resize(int cols, int rows);
 static void term_clear(int x1, int y1, int x2, int y2);
@@ -160,28 +687,120 @@ static void term_setdirty(int top, int bottom);
 static void term_fulldirty(void);
 static void term_reset(void);
 static void term_init(int cols, int rows);
+static void term_free(void);
 
 static void sel_init(void);
 static void sel_convert(Atom selection, Time time);
 static Bool sel_own(Atom selection, Time time);
 static void sel_copy(Time time);
 
+static void hint_init(void);
+static void hint_add(LineMatch *lm, int x, int len);
+static void hint_scan(int row);
+static void hint_update(void);
+static void hint_start(Bool pipe, Time time);
+static void hint_stop(void);
+static void hint_keypress(KeySym keysym, char *buf, int len, Time time);
+static void hint_draw(void);
+static void hint_label(int n, char *label);
+static void hint_choose(int n, Time time);
+static void hint_pipe(const char *s, size_t len);
+static int spawn_pipe(char **cmd);
+
+static void export_start(Bool sgr);
+static void export_encode(void);
+static void export_write(void);
+static void export_stop(void);
+static int sgr_string(const Style *style, char *s);
+
 static void set_title(char *title);
 static void set_urgency(int urgent);
 static void load_font(XFont *font, char *font_name);
+static void load_colors(void);
+static ulong rgb_pixel(ushort red, ushort green, ushort blue);
+static ulong xpixel(uint color);
+static uint color_cube(uint color);
 static void xwindow_clear(int col1, int row1, int col2, int row2);
 static void xwindow_abs_clear(int x1, int y1, int x2, int y2);
 static void xwindow_resize(int cols, int rows);
+static void xwindow_buffer(void);
+static void xwindow_release(void);
+static void xwindow_hide(void);
+static void atlas_init(void);
+static void atlas_read(XImage *img, int x, int slot);
+static int atlas_glyph(Rune r);
+static void atlas_insert(Rune r, int slot);
+static Bool shm_create(void);
+static void shm_destroy(void);
+static void shm_fill(int x, int y, int w, int h, ulong pixel);
+static void shm_draw(int x, int y, Rune *s, int len, ulong fg, ulong bg,
+		Bool underline);
+static void shm_blend(uint32_t *dst, const uchar *cov, int n,
+		uint32_t fg, uint32_t bg);
+static void xwindow_put(void);
+static void xwindow_copy(int x, int y, int w, int h);
+static void xwindow_shift(int top, int bot, int n);
+static void xwindow_scroll(int top, int bot, int n);
+static void xwindow_fill(int x, int y, int w, int h, ulong pixel);
+static void xwindow_create(void);
+static void xwindow_map(void);
 static void x_init(void);
+static void x_setup(void);
+static void trace_phase(const char *phase);
+static uint64_t trace_now(void);
+static void trace_span(const char *name, uint64_t start, const char *arg, long value);
+static void trace_count(const char *name, long value);
+static void trace_add(TraceEvent *ev);
+static void trace_write(void);
+static void trace_string(FILE *f, const char *s);
+static void mem_add(int tag, long delta);
+static void mem_report(void);
+static long pixmap_size(int w, int h);
+static void sel_settext(char **p, char *text);
+static long term_screensize(int cols, int rows);
 static void main_loop(void);
+static void loop_init(void);
+static void loop_watch(int fd, void *ptr);
+static Bool loop_watch_write(int fd, void *ptr);
+static void loop_unwatch(int fd);
+static void loop_timeout(struct timespec **tv, struct timespec *ts, double wait);
 static void exec_cmd(void);
 static void resize_all(int width, int height);
 
+static void win_new(WinOpts *opts);
+static void win_load(Win *w);
+static Win *win_find(Window xwin);
+static void win_close(Win *w, int status);
+static void frame_new(Win *w);
+static Frame *frame_find(Window xwin);
+static Bool frame_event(Frame *f, XEvent *event);
+static void frame_place(Layout *l, int x, int y, int width, int height);
+static void frame_apply(Frame *f);
+static void frame_drawtabs(Frame *f);
+static void frame_activate(Win *w);
+static void frame_remove(Frame *f, Layout *l);
+static Layout **layout_slot(Frame *f, Layout *l);
+static Layout *layout_root(Layout *l);
+static Layout *layout_first(Layout *l);
+static void pane_open(Bool tab, Bool stacked);
+static void pane_move(int dx, int dy);
+static void tab_switch(int n);
+static void reap(void);
+static char **parse_winopt(char **arg, WinOpts *opts);
+static void daemon_init(void);
+static void daemon_accept(void);
+static void client_read(Client *c);
+static void client_close(Client *c, const char *err);
+static const char *daemon_open(char *req, size_t len);
+
 static char *get_resource(char *name, char *class);
 static void extract_resources(void);
 
 static void event_keypress(XEvent *event);
+static void event_bpress(XEvent *event);
 static void event_brelease(XEvent *e);
+static void event_motion(XEvent *event);
+static void event_map(XEvent *event);
 static void event_cmessage(XEvent *event);
 static void event_resize(XEvent *event);
 static void event_expose(XEvent *event);
@@ -195,15 +814,42 @@ static void event_selclear(XEvent *event);
 static void sc_paste_sel(XKeyEvent *xkey);
 static void sc_paste_clip(XKeyEvent *xkey);
 static void sc_copy_clip(XKeyEvent *xkey);
+static void sc_hint_copy(XKeyEvent *xkey);
+static void sc_hint_pipe(XKeyEvent *xkey);
+static void sc_scroll_up(XKeyEvent *xkey);
+static void sc_scroll_down(XKeyEvent *xkey);
+static void sc_export(XKeyEvent *xkey);
+static void sc_export_sgr(XKeyEvent *xkey);
+static void sc_tab_new(XKeyEvent *xkey);
+static void sc_tab_prev(XKeyEvent *xkey);
+static void sc_tab_next(XKeyEvent *xkey);
+static void sc_split_right(XKeyEvent *xkey);
+static void sc_split_down(XKeyEvent *xkey);
+static void sc_pane_left(XKeyEvent *xkey);
+static void sc_pane_right(XKeyEvent *xkey);
+static void sc_pane_up(XKeyEvent *xkey);
+static void sc_pane_down(XKeyEvent *xkey);
 
 static int geomask_to_gravity(int mask);
 
+static void mouse_select(void);
+static Coord mouse_cell(int x, int y);
+static void mouse_report(int button, Coord cell, uint state, Bool release, Bool motion);
+static void mouse_flush(void);
+
+static void key_init(void);
+static Shortcut *key_shortcut(KeySym keysym, uint state);
+static int key_encode(KeySym keysym, uint state, char *buf, int len, int size);
+
 /* Event handlers */
 static void (*event_handler[LASTEvent])(XEvent *) = {
 	[KeyPress] = event_keypress,
+	[ButtonPress] = event_bpress,
 	[ButtonRelease] = event_brelease,
+	[MotionNotify] = event_motion,
 	[ClientMessage] = event_cmessage,
 	[ConfigureNotify] = event_resize,
+	[MapNotify] = event_map,
 	[Expose] = event_expose,
 	[FocusIn] = event_focus,
 	[FocusOut] = event_focus,
@@ -221,14 +867,53 @@ static TTY tty;
 static XWindow xw;
 static Term term;
 static Selection sel;
+static Hint hint;
+static regex_t *hint_regex;
 static DC dc;
+static Atlas atlas;
 static XResources xres;
 static XrmDatabase rDB;
 static char *res_name = NULL;
 static char *res_class = RES_CLASS;
-static char **cmd = NULL;
+static Win *wins = NULL;		/* all windows */
+static Win *win = NULL;			/* window loaded into the globals */
+static Frame *frames = NULL;	/* all frames */
+static XWindow xwdef;			/* X state shared by all windows */
+static Bool daemon_mode = False;
+static pid_t main_pid;			/* the terminal, as opposed to its children */
+static MemStat mem[MEM_LAST + 1];	/* memory of subsystems, then the total */
+static Bool mem_atexit = False;	/* report memory at exit */
+static const char *mem_names[MEM_LAST + 1] = {
+	[MEM_SCREEN] = "screen",
+	[MEM_HISTORY] = "history",
+	[MEM_SPILL] = "history spill",
+	[MEM_SPILLMAP] = "spill mappings",
+	[MEM_SELECTION] = "selections",
+	[MEM_HINTS] = "hint matches",
+	[MEM_PARSER] = "parser buffers",
+	[MEM_FONTS] = "fonts",
+	[MEM_GLYPHS] = "glyph caches",
+	[MEM_PIXMAPS] = "X pixmaps (est.)",
+	[MEM_SHM] = "shm images",
+	[MEM_LAST] = "total",
+};
+static Bool trace_startup = False;	/* report time of startup phases */
+static Bool trace_output = False;	/* first output of command was read */
+static struct timespec trace_start, trace_last;
+static char *trace_path = NULL;		/* file of the -T trace, or NULL */
+static TraceEvent *trace_ev;		/* events of the trace */
+static size_t trace_len, trace_size;	/* number of them, and room */
+static Bool trace_full = False;		/* TRACE_MAX events were recorded */
+static int sock_fd = -1;		/* termd listening socket */
+static Client *clients;			/* termd clients sending their request */
+static short sc_hash[SC_HASH_SIZ];	/* index + 1 of shortcuts by keysym, 0 if free */
+static int loop_fd = -1;		/* epoll instance of main_loop() */
+static int signal_fd = -1;		/* SIGCHLD and SIGUSR1, as read by main_loop() */
+static int timer_fd = -1;		/* next deadline of main_loop() */
+static int x_fd = -1;			/* X connection */
 
 static Atom wmdeletewin_atom;
+static Atom netwmpid_atom;
 static Atom xembed_atom;
 static Atom clipboard_atom;
 static Atom timestamp_atom;
@@ -236,6 +921,21 @@ static Atom targets_atom;
 static Atom text_atom;
 static Atom utf8_atom;
 
+/* Atoms interned by x_setup() */
+static struct {
+	char *name;
+	Atom *atom;
+} atoms[] = {
+	{ "WM_DELETE_WINDOW",	&wmdeletewin_atom },
+	{ "_NET_WM_PID",		&netwmpid_atom },
+	{ "_XEMBED",			&xembed_atom },
+	{ "CLIPBOARD",			&clipboard_atom },
+	{ "TIMESTAMP",			&timestamp_atom },
+	{ "TARGETS",			&targets_atom },
+	{ "TEXT",				&text_atom },
+	{ "UTF8_STRING",		&utf8_atom },
+};
+
 /*
  * Write count bytes to fd.
  *
@@ -264,6 +964,52 @@ static size_t sstrlen(const char *s)
 	return strlen(s);
 }
 
+/*
+ * Encode a code point as UTF-8 into s, which has room for UTF_SIZ
+ * bytes. Returns the number of bytes.
+ */
+static int utf8_encode(Rune r, char *s)
+{
+	if (r < 0x80) {
+		s[0] = r;
+		return 1;
+	} else if (r < 0x800) {
+		s[0] = 0xc0 | r >> 6;
+		s[1] = 0x80 | (r & 0x3f);
+		return 2;
+	} else if (r < 0x10000) {
+		s[0] = 0xe0 | r >> 12;
+		s[1] = 0x80 | (r >> 6 & 0x3f);
+		s[2] = 0x80 | (r & 0x3f);
+		return 3;
+	}
+	s[0] = 0xf0 | r >> 18;
+	s[1] = 0x80 | (r >> 12 & 0x3f);
+	s[2] = 0x80 | (r >> 6 & 0x3f);
+	s[3] = 0x80 | (r & 0x3f);
+	return 4;
+}
+
+/*
+ * Encode n cells as UTF-8 into s, which has room for
+ * n * UTF_SIZ * CLUSTER_MAX bytes. The cells covered by wide
+ * characters are skipped. Returns the number of bytes.
+ */
+static int utf8_string(const Rune *r, int n, char *s)
+{
+	const Rune *rs;
+	int i, j, nr, len = 0;
+
+	for (i = 0; i < n; i++) {
+		if (r[i] == WIDE_TAIL)
+			continue;
+		rs = cell_runes(&r[i], &nr);
+		for (j = 0; j < nr; j++)
+			len += utf8_encode(rs[j], s + len);
+	}
+	return len;
+}
+
 static void die(const char *fmt, ...)
 {
 	va_list ap;
@@ -291,902 +1037,5530 @@ static void warn(const char *fmt, ...)
 	fprintf(stderr, "\n");
 }
 
-static int check_mod(uint mod, uint state)
-{
-	return (mod == XK_ANY_MOD) || (mod == state);
-}
-
 /*
- * Read from the tty.
+ * Report the time taken by a startup phase, when tracing startup.
  */
-static void tty_read(void)
+static void trace_phase(const char *phase)
 {
-	char buf[BUFSIZ], *p;
-	int len;
+	struct timespec now;
 
-	if ((len = read(tty.fd, buf, sizeof(buf))) < 0)
-		die("Failed to read from shell: %s", strerror(errno));
+	if (trace_path)
+		trace_add(&(TraceEvent){ .name = phase, .ph = 'i', .ts = trace_now() });
+	if (!trace_startup)
+		return;
 
-	// FIXME
-	DEBUG("%s", buf);
-//	XSetForeground(xw.display, dc.gc, dc.colors[color_fg].pixel);
-//	XmbDrawString(xw.display, xw.win, dc.font.font_set, dc.gc,
-//			0, 0, buf, strlen(buf));
-//	XFlush(xw.display);
-	
-	for (p = buf; *p; p++) {
-		term_putc(*p);
-	}
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	fprintf(stderr, "%s: %-20s %8.3f ms (%8.3f ms total)\n", argv0, phase,
+			TIMEDIFF(now, trace_last), TIMEDIFF(now, trace_start));
+	trace_last = now;
 }
 
 /*
- * Write a string to the tty.
+ * Time (us) since startup when writing a -T trace, 0 otherwise.
  */
-static void tty_write(const char *s, size_t len)
+static uint64_t trace_now(void)
 {
-	if (swrite(tty.fd, s, len) == -1)
-		die("write error on tty: %s", strerror(errno));
+	struct timespec now;
+
+	if (!trace_path)
+		return 0;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (now.tv_sec - trace_start.tv_sec) * 1000000 +
+		(now.tv_nsec - trace_start.tv_nsec) / 1000;
 }
 
 /*
- * Resize the tty.
+ * Record a span of the trace that began at start (from trace_now()),
+ * with a value named arg unless it is NULL.
  */
-static void tty_resize(int cols, int rows)
+static void trace_span(const char *name, uint64_t start, const char *arg, long value)
 {
-	/* Update fields in winsize struct */
-	tty.ws.ws_row = rows;
-	tty.ws.ws_col = cols;
-	tty.ws.ws_xpixel = cols * xw.cw;
-	tty.ws.ws_ypixel = rows * xw.ch;
-
-	if (ioctl(tty.fd, TIOCSWINSZ, &tty.ws) < 0)
-		debug(D_WARN, "unable to set window size: %s", strerror(errno));
+	if (!trace_path)
+		return;
+	trace_add(&(TraceEvent){ .name = name, .ph = 'X', .arg = arg,
+		.value = value, .ts = start, .dur = trace_now() - start });
 }
 
-static int x_error_handler(Display *display, XErrorEvent *ev)
+/*
+ * Record a value of the counter track name.
+ */
+static void trace_count(const char *name, long value)
 {
-	char buf[BUFSIZ/4];
-
-	XGetErrorText(display, ev->error_code, buf, BUFSIZ/4);
-	die(buf);
-
-	return 0;
+	if (!trace_path)
+		return;
+	trace_add(&(TraceEvent){ .name = name, .ph = 'C', .arg = "value",
+		.value = value, .ts = trace_now() });
 }
 
 /*
- * KeyPress event handler.
+ * Append an event to the trace, kept in memory until exit.
  */
-static void event_keypress(XEvent *event)
+static void trace_add(TraceEvent *ev)
 {
-	XKeyEvent *key_event = &event->xkey;
-	KeySym keysym;
-	char buf[32];
-	Shortcut *sc;
-	int len;
-
-	len = XmbLookupString(xw.xic, key_event, buf, sizeof(buf), &keysym, NULL);
-
-	/* Shortcuts */
-	for (sc = shortcuts; sc < shortcuts+LEN(shortcuts); sc++) {
-		if (keysym == sc->keysym && check_mod(sc->mod, key_event->state)) {
-			sc->func(key_event);
+	if (trace_len == trace_size) {
+		if (trace_size == TRACE_MAX) {
+			if (!trace_full)
+				debug(D_WARN, "trace full, dropping events");
+			trace_full = True;
 			return;
 		}
+		trace_size = trace_size ? 2 * trace_size : 4096;
+		if (!(trace_ev = realloc(trace_ev, trace_size * sizeof(*trace_ev))))
+			die("realloc failed: %s", strerror(errno));
 	}
+	trace_ev[trace_len++] = *ev;
+}
 
-	if (len == 0)
+/*
+ * Write the trace as Chrome trace event JSON, which chrome://tracing
+ * and Perfetto read. Runs at exit.
+ */
+static void trace_write(void)
+{
+	TraceEvent *ev;
+	FILE *f;
+	size_t i;
+	int pid = getpid();
+
+	/* Not from a child that failed to exec */
+	if (pid != main_pid)
 		return;
 
-	DEBUG("key pressed: %s", buf);
+	if (!(f = fopen(trace_path, "w"))) {
+		warn("open %s failed: %s", trace_path, strerror(errno));
+		return;
+	}
 
-	// FIXME
+	fprintf(f, "{\"traceEvents\":[\n");
+	fprintf(f, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,"
+			"\"args\":{\"name\":", pid);
+	trace_string(f, argv0);
+	fprintf(f, "}}");
+	for (i = 0; i < trace_len; i++) {
+		ev = &trace_ev[i];
+		fprintf(f, ",\n{\"name\":");
+		trace_string(f, ev->name);
+		fprintf(f, ",\"ph\":\"%c\",\"pid\":%d,\"tid\":%d,"
+				"\"ts\":%" PRIu64, ev->ph, pid, pid, ev->ts);
+		if (ev->ph == 'X')
+			fprintf(f, ",\"dur\":%" PRIu64, ev->dur);
+		else if (ev->ph == 'i')
+			fprintf(f, ",\"s\":\"p\"");
+		if (ev->arg)
+			fprintf(f, ",\"args\":{\"%s\":%ld}", ev->arg, ev->value);
+		fprintf(f, "}");
+	}
+	fprintf(f, "\n]}\n");
 
-	tty_write(buf, len);
+	if (fclose(f) == EOF)
+		warn("write %s failed: %s", trace_path, strerror(errno));
+	free(trace_ev);
 }
 
 /*
- * ButtonRelease event handler.
+ * Write s as a JSON string.
  */
-static void event_brelease(XEvent *event)
+static void trace_string(FILE *f, const char *s)
 {
-	if (event->xbutton.button == Button1) {
-		sel_convert(XA_PRIMARY, event->xbutton.time);
-	} else if (event->xbutton.button == Button2) {
-		sel_copy(event->xbutton.time);
+	fputc('"', f);
+	for (; *s; s++) {
+		if (*s == '"' || *s == '\\')
+			fprintf(f, "\\%c", *s);
+		else if ((uchar)*s < 0x20)
+			fprintf(f, "\\u%04x", (uchar)*s);
+		else
+			fputc(*s, f);
 	}
+	fputc('"', f);
 }
 
 /*
- * ClientMessage event handler.
+ * Account delta bytes (freed if negative) to a subsystem.
  */
-static void event_cmessage(XEvent *event)
+static void mem_add(int tag, long delta)
 {
-	if (event->xclient.data.l[0] == wmdeletewin_atom) {
-		/* Destroy window */
-		XCloseDisplay(xw.display);
-		exit(EXIT_SUCCESS);
-	} else if (event->xclient.message_type == xembed_atom && event->xclient.format == 32) {
-		/* XEmbed message */
-		if (event->xclient.data.l[1] == XEMBED_FOCUS_IN) {
-			xw.state |= WIN_FOCUSED;
-			set_urgency(0);
-		} else if (event->xclient.data.l[1] == XEMBED_FOCUS_OUT) {
-			xw.state &= ~WIN_FOCUSED;
-		}
-	}
+	mem[tag].cur += delta;
+	mem[tag].peak = MAX(mem[tag].peak, mem[tag].cur);
+	mem[MEM_LAST].cur += delta;
+	mem[MEM_LAST].peak = MAX(mem[MEM_LAST].peak, mem[MEM_LAST].cur);
 }
 
 /*
- * ConfigureNotify event handler.
+ * Estimate of the server memory of a pixmap of the default depth.
  */
-static void event_resize(XEvent *event)
+static long pixmap_size(int w, int h)
 {
-	/* Only resize if size was actually changed */
-	if (event->xconfigure.width == xw.width && event->xconfigure.height == xw.height)
-		return;
+	int depth = DefaultDepth(xw.display, xw.screen);
 
-	resize_all(event->xconfigure.width, event->xconfigure.height);
+	return (long)w * h * (depth > 16 ? 4 : depth > 8 ? 2 : 1);
 }
 
 /*
- * Expose event handler.
+ * Print the memory of each subsystem, and its high-water mark, on
+ * SIGUSR1 and at exit with --mem-report. All windows are counted.
  */
-static void event_expose(XEvent *event)
+static void mem_report(void)
 {
-	XExposeEvent *xexpose = &event->xexpose;
+	int i;
 
-	if (xw.state & WIN_REDRAW) {
-		if (xexpose->count == 0)
-			xw.state &= ~WIN_REDRAW;
+	/* Not from a child that failed to exec */
+	if (getpid() != main_pid)
+		return;
+
+	fprintf(stderr, "%s: memory (KiB)       current       peak\n", argv0);
+	for (i = 0; i <= MEM_LAST; i++) {
+		fprintf(stderr, "  %-20s %10.1f %10.1f\n", mem_names[i],
+				mem[i].cur / 1024.0, mem[i].peak / 1024.0);
 	}
+}
 
-	redraw();
+static int check_mod(uint mod, uint state)
+{
+	return (mod == XK_ANY_MOD) || (mod == state);
 }
 
-static void event_focus(XEvent *event)
+/*
+ * Hash the shortcuts by keysym, so that looking up a key
+ * costs the same however many of them there are.
+ */
+static void key_init(void)
 {
-	XFocusChangeEvent *xfocus = &event->xfocus;
+	uint i, h;
 
-	if (xfocus->mode == NotifyGrab)
-		return;
+	if (LEN(shortcuts) > SC_HASH_SIZ / 2)
+		die("too many shortcuts: raise SC_HASH_SIZ");
 
-	if (event->type == FocusIn) {
-		xw.state |= WIN_FOCUSED;
-		set_urgency(0);
-		XSetICFocus(xw.xic);
-		DEBUG("FOCUS IN");
-	} else {
-		xw.state &= ~WIN_FOCUSED;
-		XUnsetICFocus(xw.xic);
-		DEBUG("FOCUS OUT");
+	for (i = 0; i < LEN(shortcuts); i++) {
+		for (h = shortcuts[i].keysym % SC_HASH_SIZ; sc_hash[h]; h = (h + 1) % SC_HASH_SIZ)
+			;
+		sc_hash[h] = i + 1;
 	}
 }
 
 /*
- * UnmapNotify event handler.
+ * Find the shortcut of a key, or NULL.
  */
-static void event_unmap(XEvent *event)
+static Shortcut *key_shortcut(KeySym keysym, uint state)
 {
-	/* Unset visibility bit of state mask */
-	xw.state &= ~WIN_VISIBLE;
+	Shortcut *sc;
+	uint h;
+
+	for (h = keysym % SC_HASH_SIZ; sc_hash[h]; h = (h + 1) % SC_HASH_SIZ) {
+		sc = &shortcuts[sc_hash[h] - 1];
+		if (sc->keysym == keysym && check_mod(sc->mod, state))
+			return sc;
+	}
+	return NULL;
 }
 
 /*
- * VisibilityNotify event handler.
+ * Encode a key for the tty into buf, the way xterm does. len is the
+ * length of the text the key typed, already in buf. Returns the
+ * length of the encoding.
  */
-static void event_visibility(XEvent *event)
+static int key_encode(KeySym keysym, uint state, char *buf, int len, int size)
 {
-	XVisibilityEvent *xvisibility = &event->xvisibility;
+	const Key *k;
+	const char *seq = NULL;
+	int mod = 1, code = -1, n;
+
+	if (state & ShiftMask)
+		mod += 1;
+	if (state & Mod1Mask)
+		mod += 2;
+	if (state & ControlMask)
+		mod += 4;
+
+	if (keysym == XK_ISO_Left_Tab)
+		return snprintf(buf, size, "\033[Z");
+	if (BETWEEN(keysym, 0xff00, 0xffff)) {
+		k = &keys[KEY(keysym)];
+		seq = (k->appseq && (term.mode & k->appmode)) ? k->appseq : k->seq;
+	}
 
-	if (xvisibility->state == VisibilityFullyObscured) {
-		/* Unset visibility bit of state mask */
-		xw.state &= ~WIN_VISIBLE;
-	} else if (!(xw.state & WIN_VISIBLE)) {
-		/* Window has become visible - flag for redraw */
-		xw.state |= WIN_VISIBLE | WIN_REDRAW;
+	/* Sequences carry the modifiers as a parameter: CSI A is CSI 1;mod A */
+	if (seq && seq[0] == '\033' && seq[1]) {
+		n = strlen(seq);
+		if (mod == 1 || (seq[1] == 'O' && !strchr("ABCDFHPQRS", seq[n-1])))
+			return snprintf(buf, size, "%s", seq);
+		if (n == 3)
+			return snprintf(buf, size, "\033[1;%d%c", mod, seq[n-1]);
+		return snprintf(buf, size, "%.*s;%d%c", n - 1, seq, mod, seq[n-1]);
+	}
+
+	/* Keys typing text, and the code point modifyOtherKeys reports */
+	if (seq) {
+		len = snprintf(buf, size, "%s", seq);
+		code = (uchar)seq[0];
+	} else if (keysym < 0x100) {
+		code = keysym;
+	} else if ((keysym & 0xff000000) == 0x01000000) {
+		code = keysym & 0xffffff;
+	} else if (BETWEEN(keysym, 0xff00, 0xffff) && len == 1) {
+		code = (uchar)buf[0];
 	}
+	if (len <= 0)
+		return 0;
+
+	/*
+	 * modifyOtherKeys: level 2 reports every modified key but shifted
+	 * characters, level 1 the ones Control makes no control character of
+	 */
+	if (code >= 0 && mod > 1 && ((term.modkeys == 2 &&
+			(mod != 2 || code < 0x20 || code == 0x7f)) ||
+			(term.modkeys == 1 && (state & ControlMask) &&
+			!(len == 1 && (uchar)buf[0] < 0x20 && (code >= 0x40 || code == ' ')))))
+		return snprintf(buf, size, "\033[27;%d;%d~", mod, code);
+
+	/* Alt prefixes the text with ESC */
+	if ((state & Mod1Mask) && len < size) {
+		memmove(buf + 1, buf, len);
+		buf[0] = '\033';
+		len++;
+	}
+
+	return len;
 }
 
 /*
- * SelectionNotify event handler.
+ * Select pointer motion events on the loaded window
+ * only while a mouse mode reports them.
  */
-static void event_selnotify(XEvent *event)
+static void mouse_select(void)
 {
-	XSelectionEvent *xsev;
-	ulong offset, nitems, after;
-	Atom target;
-	int format;
-	uchar *data;
+	long mask = EVENT_MASK;
 
-	xsev = &event->xselection;
+	if (term.mode & MODE_MOUSEMOTION)
+		mask |= PointerMotionMask;
+	else if (term.mode & MODE_MOUSEDRAG)
+		mask |= ButtonMotionMask;
 
-	if (xsev->property == None) {
-		/* Selection conversion refused */
-		return;
+	if (mask != xw.attrs.event_mask) {
+		xw.attrs.event_mask = mask;
+		XChangeWindowAttributes(xw.display, xw.win, CWEventMask, &xw.attrs);
 	}
+}
 
-	/* Get selection contents in chunks */
-	offset = 0L;
-	do {
-		XGetWindowProperty(xw.display, xw.win, xsev->property,
-				offset, BUFSIZ/4, False, (Atom)AnyPropertyType,
-				&target, &format, &nitems, &after, &data);
+/*
+ * Cell under the window coordinates x, y.
+ */
+static Coord mouse_cell(int x, int y)
+{
+	Coord c;
 
-		if (target != sel.target || target != XA_STRING ||
-				target != text_atom) {
-			/* non-TEXT target */
-			debug(D_WARN, "selection notify: unhandled target 0x%lx",
-					target);
-			break;
-		}
-
-		puts((char *)data);
-
-		XFree(data);
-
-		offset += (nitems * format) / 32;
-	} while (after > 0);
-
-	XDeleteProperty(xsev->display, xsev->requestor, xsev->property);
+	c.x = (x - xw.border) / xw.cw;
+	c.y = (y - xw.border) / xw.ch;
+	LIMIT(c.x, 0, term.cols - 1);
+	LIMIT(c.y, 0, term.rows - 1);
+	return c;
 }
 
 /*
- * SelectionRequest event handler.
+ * Report a mouse event to the tty the way xterm does, with SGR
+ * encoding (1006) or else the legacy one. button is 0-2 for the
+ * left, middle and right buttons, 3 for none and 64 on for the wheel.
  */
-static void event_selrequest(XEvent *event)
+static void mouse_report(int button, Coord cell, uint state, Bool release, Bool motion)
 {
-	XSelectionRequestEvent *xsrev;
-	XSelectionEvent xsev;
-	Time timestamp;
-	char *sel_text;
-
-	xsrev = &event->xselectionrequest;
-
-	xsev.type = SelectionNotify;
-	xsev.display = xsrev->display;
-	xsev.requestor = xsrev->requestor;
-	xsev.selection = xsrev->selection;
-	xsev.target = xsrev->target;
-	xsev.time = xsrev->time;
-
-	if (xsrev->property == None) {
-		/* Obsolete requestor */
-		xsrev->property = xsrev->target;
-	}
-
-	if (xsrev->target == timestamp_atom) {
-		/* TIMESTAMP request: return timestamp used to acquire selection */
-		if (xsrev->selection == XA_PRIMARY) {
-			timestamp = sel.sel_time;
-		} else if (xsrev->selection == clipboard_atom) {
-			timestamp = sel.clip_time;
-		} else {
-			debug(D_WARN, "timestamp request: unhandled selection: 0x%lx",
-					xsrev->selection);
-			return;
-			/* FIXME: refuse conversion? */
-		}
-		xsev.property = xsrev->property;
-		XChangeProperty(xsev.display, xsev.requestor, xsev.property,
-				XA_INTEGER, 32, PropModeReplace,
-				(uchar *)timestamp, 1);
-	} else if (xsrev->target == targets_atom) {
-		/* TARGETS request: return list of supported targets */
-		Atom supported[3] = { XA_STRING, text_atom, utf8_atom };
-
-		xsev.property = xsrev->property;
-		XChangeProperty(xsev.display, xsev.requestor, xsev.property,
-				XA_ATOM, 32, PropModeReplace,
-				(uchar *)supported, LEN(supported));
-	} else if (xsrev->target == sel.target || xsrev->target == XA_STRING
-			|| xsrev->target == text_atom) {
-		/* STRING, TEXT request */
-		if (xsrev->selection == XA_PRIMARY) {
-			sel_text = sel.primary;
-		} else if (xsrev->selection == clipboard_atom) {
-			sel_text = sel.clipboard;
-		} else {
-			debug(D_WARN, "text request: unhandled selection: 0x%lx",
-					xsrev->selection);
-			return;
-		}
-		if (sel_text) {
-			xsev.property = xsrev->property;
-			XChangeProperty(xsev.display, xsev.requestor,
-					xsev.property, xsev.target, 8,
-					PropModeReplace, (uchar *)sel_text,
-					sstrlen(sel_text));
-		}
+	char buf[32];
+	int b = button, len;
+
+	if (state & ShiftMask)
+		b += 4;
+	if (state & Mod1Mask)
+		b += 8;
+	if (state & ControlMask)
+		b += 16;
+	if (motion)
+		b += 32;
+
+	if (term.mode & MODE_MOUSESGR) {
+		len = snprintf(buf, sizeof(buf), "\033[<%d;%d;%d%c", b,
+				cell.x + 1, cell.y + 1, release ? 'm' : 'M');
 	} else {
-		/* Refuse conversion to requested target */
-		xsev.property = None;
+		/* Releases don't say which button, and cells past 222 don't fit */
+		if (release)
+			b |= 3;
+		if (cell.x > 222 || cell.y > 222)
+			return;
+		len = snprintf(buf, sizeof(buf), "\033[M%c%c%c",
+				32 + b, 33 + cell.x, 33 + cell.y);
 	}
 
-	if (!XSendEvent(xsev.display, xsev.requestor,
-				False, (ulong)NULL, (XEvent *)&xsev))
-		debug(D_WARN, "error sending SelectionNotify event");
+	tty_write(buf, len);
+	xw.mousecell = cell;
 }
 
 /*
- * SelectionClear event handler.
+ * Report the last pointer motion of the frame, if it
+ * moved to another cell and the mouse mode wants it.
  */
-static void event_selclear(XEvent *event)
+static void mouse_flush(void)
 {
-	/*
-	 * TODO: clear logical & visual selection.
-	 */
-}
+	Coord c = xw.motioncell;
+	uint state = xw.motionstate;
+	int button;
 
-static void sc_paste_sel(XKeyEvent *xkey)
-{
-	sel_convert(XA_PRIMARY, xkey->time);
-}
+	if (!xw.motionpending)
+		return;
+	xw.motionpending = False;
 
-static void sc_paste_clip(XKeyEvent *xkey)
-{
-	sel_convert(clipboard_atom, xkey->time);
-}
+	if (!(term.mode & (MODE_MOUSEDRAG | MODE_MOUSEMOTION)) || (state & ShiftMask) ||
+			(c.x == xw.mousecell.x && c.y == xw.mousecell.y))
+		return;
 
-static void sc_copy_clip(XKeyEvent *xkey)
-{
-	if (sel.clipboard != NULL) {
-		free(sel.clipboard);
-	}
-	if (sel.primary != NULL) {
-		sel.clipboard = strdup(sel.primary);
-		if (sel_own(clipboard_atom, xkey->time))
-			sel.clip_time = xkey->time;
-	}
+	button = (state & Button1Mask) ? 0 : (state & Button2Mask) ? 1 :
+		(state & Button3Mask) ? 2 : 3;
+	if (button == 3 && !(term.mode & MODE_MOUSEMOTION))
+		return;
+
+	mouse_report(button, c, state, False, True);
 }
 
 /*
- * Draw the buffer into the window.
+ * Read from the tty.
  */
-static void draw(void)
+static void tty_read(void)
 {
-	draw_region(0, 0, term.cols, term.rows);
-	XCopyArea(xw.display, xw.drawbuf, xw.win, dc.gc,
-			0, 0, xw.width, xw.height, 0, 0);
-	XSetForeground(xw.display, dc.gc, dc.colors[color_bg].pixel);
+	char buf[BUFSIZ];
+	struct pollfd pfd = { .fd = tty.fd, .events = POLLIN };
+	struct timespec start, now;
+	uint64_t t = trace_now();
+	int len;
+
+	/* Output restarts the cursor blink */
+	clock_gettime(CLOCK_MONOTONIC, &xw.blinktime);
+
+	if (tty.ring) {
+		ring_drain();
+		hint_update();
+		trace_span("tty_read", t, NULL, 0);
+		return;
+	}
+
+	/*
+	 * Jump scroll: while full reads show that output keeps coming,
+	 * parse it for up to parse_time ms before the next frame. The
+	 * screens in between are never drawn.
+	 */
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	do {
+		if ((len = read(tty.fd, buf, sizeof(buf))) < 0) {
+			/* Slave side closed: the window goes once the child is reaped */
+			if (errno == EIO) {
+				loop_unwatch(tty.fd);
+				close(tty.fd);
+				tty.fd = -1;
+				return;
+			}
+			die("Failed to read from shell: %s", strerror(errno));
+		}
+		tty_parse(buf, len);
+		clock_gettime(CLOCK_MONOTONIC, &now);
+	} while (len == sizeof(buf) && TIMEDIFF(now, start) < parse_time &&
+			poll(&pfd, 1, 0) > 0);
+
+	/* Index the lines committed by this read */
+	hint_update();
+	trace_span("tty_read", t, NULL, 0);
 }
 
 /*
- * Copy the internal terminal buffer to the window buffer,
- * within the specified region.
- * TODO
+ * Feed output of the command to the terminal.
  */
-static void draw_region(int col1, int row1, int col2, int row2)
+static void tty_parse(const char *buf, int len)
 {
-	int row;
-	//int col;
+	const char *p = buf, *end = buf + len, *q;
+	uint64_t start = trace_now();
 
-	/* Check if window is visible */
-	if (!(xw.state & WIN_VISIBLE))
-		return;
-
-	for (row = row1; row < row2; row++) {
-		/* Skip clean lines */
-		if (!term.dirty[row])
-			continue;
-
-		/* Clear current row in buffer and reset dirtyness */
-		xwindow_clear(0, row, term.cols, row);
-//		term.dirty[row] = False;
+	if (trace_startup && !trace_output) {
+		trace_output = True;
+		trace_phase("first output");
+	}
 
-		/* TODO ... */
-		XSetForeground(xw.display, dc.gc, dc.colors[color_fg].pixel);
-		XmbDrawString(xw.display, xw.drawbuf, dc.font.font_set, dc.gc,
-				0, 0, term.line[row], sstrlen(term.line[row]));
+	while (p < end) {
+		/* OSC strings are taken whole, up to the control ending them */
+		if (term.esc == ESC_OSC) {
+			q = osc_span(p, end);
+			osc_put(p, q - p);
+			if ((p = q) == end)
+				break;
+		}
+		term_putc(*p++);
 	}
+
+	trace_span("parse", start, "bytes", len);
 }
 
 /*
- * Force a complete redraw of the window.
+ * Get the fd that becomes readable when there is output of
+ * the command to read, or -1 once the pty hung up.
  */
-static void redraw(void)
+static int tty_pollfd(void)
 {
-	term_fulldirty();
-	draw();
+	if (tty.ring)
+		return tty.ring->datafd;
+	return tty.fd;
 }
 
 /*
- * TODO
+ * Check whether the reader thread has output buffered
+ * that was left over by the parse budget.
  */
-static void term_putc(char c)
+static Bool tty_pending(void)
 {
-	term.line[term.cursor.y][term.cursor.x] = c;
-	term.dirty[term.cursor.y] = True;
-
-	term_moveto(++term.cursor.x, term.cursor.y);
+	return tty.ring && atomic_load(&tty.ring->head) != atomic_load(&tty.ring->tail);
 }
 
-static void term_moveto(int x, int y)
+/*
+ * Start a reader thread for the pty.
+ */
+static void ring_new(int fd)
 {
-	term.cursor.x = LIMIT(x, 0, term.cols-1);
-	term.cursor.y = LIMIT(y, 0, term.rows-1);
+	sigset_t mask, origmask;
+	Ring *r;
+
+	/* calloc would not keep head and tail on their own cache lines */
+	if (!(r = aligned_alloc(_Alignof(Ring), sizeof(*r))))
+		die("aligned_alloc failed: %s", strerror(errno));
+	memset(r, 0, sizeof(*r));
+	mem_add(MEM_PARSER, sizeof(*r));
+
+	r->fd = fd;
+	if ((r->datafd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) < 0 ||
+			(r->spacefd = eventfd(0, EFD_CLOEXEC)) < 0)
+		die("eventfd failed: %s", strerror(errno));
+
+	/* Signals are left to the main thread */
+	sigfillset(&mask);
+	pthread_sigmask(SIG_SETMASK, &mask, &origmask);
+	if ((errno = pthread_create(&r->thread, NULL, ring_reader, r)))
+		die("pthread_create failed: %s", strerror(errno));
+	pthread_sigmask(SIG_SETMASK, &origmask, NULL);
+
+	tty.ring = r;
 }
 
 /*
- * Resize terminal (internal).
+ * Reader thread: copy the pty into the ring. When the ring is full it
+ * stops reading until the main thread makes space, so the kernel's pty
+ * buffer fills up and the command blocks on its writes.
  */
-static void term_resize(int cols, int rows)
+static void *ring_reader(void *arg)
 {
-	int i;
-	int mincols = MIN(term.cols, cols);
-	int minrows = MIN(term.rows, rows);
+	Ring *r = arg;
+	size_t head, tail, off;
+	ssize_t len;
+	uint64_t v;
 
-	for (i = 0; i <= term.cursor.y - rows; i++) {
-		free(term.line[i]);
-	}
-	if (i > 0) {
-		memmove(term.line, term.line + i, rows * sizeof(*term.line));
-	}
-	for (i += rows; i < term.rows; i++) {
-		free(term.line[i]);
-	}
+	while (1) {
+		head = atomic_load_explicit(&r->head, memory_order_relaxed);
+		tail = atomic_load(&r->tail);
+
+		if (head - tail == RING_SIZ) {
+			/* Full: wait for the main thread, then look again */
+			atomic_store(&r->waiting, 1);
+			if (atomic_load(&r->tail) == tail && read(r->spacefd, &v, sizeof(v)) < 0
+					&& errno != EINTR)
+				break;
+			atomic_store(&r->waiting, 0);
+			continue;
+		}
 
-	/* Reallocate height dependent elements */
-	term.line = realloc(term.line, rows * sizeof(*term.line));
-	term.dirty = realloc(term.dirty, rows * sizeof(*term.dirty));
+		/* Read into the contiguous free space after head */
+		off = head % RING_SIZ;
+		len = MIN(RING_SIZ - (head - tail), RING_SIZ - off);
+		if ((len = read(r->fd, r->buf + off, len)) < 0 && errno == EINTR)
+			continue;
+		if (len <= 0)
+			break;
 
-	/* Resize rows */
-	for (i = 0; i < minrows; i++) {
-		term.line[i] = realloc(term.line[i], cols * sizeof(*term.line[i]));
-	}
-	/* Allocate new rows (if any) */
-	for (; i < rows; i++) {
-		term.line[i] = malloc(cols * sizeof(*term.line[i]));
+		atomic_store(&r->head, head + len);
+		/* Only signal when the main thread may be waiting */
+		if (!atomic_exchange(&r->notified, 1))
+			eventfd_write(r->datafd, 1);
 	}
 
-	/* Update terminal size */
-	term.cols = cols;
-	term.rows = rows;
+	atomic_store(&r->hangup, 1);
+	if (!atomic_exchange(&r->notified, 1))
+		eventfd_write(r->datafd, 1);
 
-	/* Clear new cols */
-	if (cols > mincols && rows > 0)
-		term_clear(mincols, 0, cols - 1, minrows - 1);
-	/* Clear new rows (and new cols/rows overlap) */
-	if (rows > minrows && cols > 0)
-		term_clear(0, minrows, cols - 1, rows - 1);
+	return NULL;
 }
 
 /*
- * Clear a region of the internal terminal.
+ * Parse the output buffered by the reader thread, PARSE_BUDGET bytes
+ * at a time for at most parse_time ms, so that a burst of output never
+ * holds up X events.
  */
-static void term_clear(int x1, int y1, int x2, int y2)
+static void ring_drain(void)
 {
-	int x, y;
-
-	/* Contrain coords */
-	LIMIT(x1, 0, term.cols-1);
-	LIMIT(y1, 0, term.rows-1);
-	LIMIT(x2, 0, term.cols-1);
-	LIMIT(y2, 0, term.rows-1);
+	Ring *r = tty.ring;
+	size_t head, tail, off, len;
+	struct timespec start, now;
+	eventfd_t v;
+	int hangup;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+
+	/* Re-arm notification before looking at head, so no data is missed */
+	eventfd_read(r->datafd, &v);
+	atomic_store(&r->notified, 0);
+
+	/* The reader's last head is stored before hangup: load them the
+	 * other way round, so that no output is left when hanging up */
+	hangup = atomic_load_explicit(&r->hangup, memory_order_acquire);
+	head = atomic_load(&r->head);
+	tail = atomic_load_explicit(&r->tail, memory_order_relaxed);
+
+	if (head == tail && hangup) {
+		/* Slave side closed: the window goes once the child is reaped */
+		ring_free();
+		close(tty.fd);
+		tty.fd = -1;
+		return;
+	}
 
-	for (y = y1; y <= y2; y++) {
-		term.dirty[y] = True;
-		for (x = x1; x <= x2; x++) {
-			term.line[y][x] = ' ';
+	do {
+		if (head - tail > PARSE_BUDGET)
+			head = tail + PARSE_BUDGET;
+
+		/* Parse in place, in at most two pieces when wrapping around */
+		while (tail != head) {
+			off = tail % RING_SIZ;
+			len = MIN(head - tail, RING_SIZ - off);
+			tty_parse(r->buf + off, len);
+			tail += len;
 		}
-	}
+
+		atomic_store(&r->tail, tail);
+		if (atomic_load(&r->waiting))
+			eventfd_write(r->spacefd, 1);
+
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		head = atomic_load(&r->head);
+	} while (head != tail && TIMEDIFF(now, start) < parse_time);
 }
 
 /*
- * Set term rows in range [top,bottom] as dirty.
+ * Stop the reader thread and free its ring.
  */
-static void term_setdirty(int top, int bottom)
+static void ring_free(void)
 {
-	int i;
-
-	LIMIT(top, 0, term.rows-1);
-	LIMIT(bottom, 0, term.rows-1);
-
-	for (i = top; i <= bottom; i++)
-		term.dirty[i] = True;
+	Ring *r = tty.ring;
+
+	pthread_cancel(r->thread);
+	pthread_join(r->thread, NULL);
+	loop_unwatch(r->datafd);
+	close(r->datafd);
+	close(r->spacefd);
+	free(r);
+	mem_add(MEM_PARSER, -(long)sizeof(*r));
+	tty.ring = NULL;
 }
 
 /*
- * Set all term rows as dirty.
+ * Write a string to the tty.
  */
-static void term_fulldirty(void)
+static void tty_write(const char *s, size_t len)
 {
-	term_setdirty(0, term.rows-1);
+	if (tty.fd < 0)
+		return;
+	if (swrite(tty.fd, s, len) == -1)
+		die("write error on tty: %s", strerror(errno));
 }
 
 /*
- * Initialize Selection. Must be called after
- * x_init() in order to set target atom.
+ * Resize the tty.
  */
-static void sel_init(void)
+static void tty_resize(int cols, int rows)
 {
-	sel.primary = NULL;
-	sel.clipboard = NULL;
-	sel.target = utf8_atom;
-}
+	/* Nothing to do once the command hung up */
+	if (tty.fd < 0)
+		return;
 
-static void sel_convert(Atom selection, Time time)
-{
-	DEBUG("Converting selection");
+	/* Update fields in winsize struct */
+	tty.ws.ws_row = rows;
+	tty.ws.ws_col = cols;
+	tty.ws.ws_xpixel = cols * xw.cw;
+	tty.ws.ws_ypixel = rows * xw.ch;
 
-	XConvertSelection(xw.display, selection, sel.target,
-			sel.target, xw.win, time);
+	if (ioctl(tty.fd, TIOCSWINSZ, &tty.ws) < 0)
+		debug(D_WARN, "unable to set window size: %s", strerror(errno));
 }
 
-static Bool sel_own(Atom selection, Time time)
+static int x_error_handler(Display *display, XErrorEvent *ev)
 {
-	XSetSelectionOwner(xw.display, selection, xw.win, time);
+	char buf[BUFSIZ/4];
 
-	if (XGetSelectionOwner(xw.display, selection) != xw.win) 
-		return False;
+	XGetErrorText(display, ev->error_code, buf, BUFSIZ/4);
+	die(buf);
+
+	return 0;
+}
+
+/*
+ * KeyPress event handler.
+ */
+static void event_keypress(XEvent *event)
+{
+	XKeyEvent *key_event = &event->xkey;
+	KeySym keysym;
+	char buf[32];
+	Shortcut *sc;
+	uint state;
+	int len;
+
+	len = XmbLookupString(xw.xic, key_event, buf, sizeof(buf), &keysym, NULL);
+
+	/* Typing restarts the cursor blink */
+	clock_gettime(CLOCK_MONOTONIC, &xw.blinktime);
+
+	/* Hint mode consumes all keys until a hint is chosen */
+	if (hint.active) {
+		hint_keypress(keysym, buf, len, key_event->time);
+		return;
+	}
+
+	/* Lock modifiers don't change what a key does */
+	state = key_event->state & ~(LockMask | Mod2Mask);
+
+	if ((sc = key_shortcut(keysym, state))) {
+		sc->func(key_event);
+		return;
+	}
+
+	if ((len = key_encode(keysym, state, buf, MAX(len, 0), sizeof(buf))) == 0)
+		return;
+
+	/* Typing brings the view back to the screen */
+	view_scroll(-term.scroll);
+
+	DEBUG("key pressed: %s", buf);
+
+	tty_write(buf, len);
+}
+
+/*
+ * ButtonPress event handler.
+ */
+static void event_bpress(XEvent *event)
+{
+	XButtonEvent *e = &event->xbutton;
+	int button;
+
+	/* Clicking a pane types into it */
+	frame_activate(win);
+
+	/* Without mouse reporting, the wheel scrolls through history */
+	if (!(term.mode & MODE_MOUSE) || (e->state & ShiftMask)) {
+		if (e->button == Button4)
+			view_scroll(scroll_lines);
+		else if (e->button == Button5)
+			view_scroll(-scroll_lines);
+		return;
+	}
+
+	if (BETWEEN(e->button, Button1, Button3))
+		button = e->button - Button1;
+	else if (BETWEEN(e->button, Button4, Button5 + 2))
+		button = 64 + e->button - Button4;	/* wheel */
+	else
+		return;
+
+	mouse_flush();
+	mouse_report(button, mouse_cell(e->x, e->y), e->state, False, False);
+}
+
+/*
+ * ButtonRelease event handler.
+ */
+static void event_brelease(XEvent *event)
+{
+	XButtonEvent *e = &event->xbutton;
+
+	if ((term.mode & MODE_MOUSE) && !(e->state & ShiftMask)) {
+		/* Wheel releases are not reported */
+		if (BETWEEN(e->button, Button1, Button3)) {
+			mouse_flush();
+			mouse_report(e->button - Button1, mouse_cell(e->x, e->y),
+					e->state, True, False);
+		}
+		return;
+	}
+
+	if (event->xbutton.button == Button1) {
+		sel_convert(XA_PRIMARY, event->xbutton.time);
+	} else if (event->xbutton.button == Button2) {
+		sel_copy(event->xbutton.time);
+	}
+}
+
+/*
+ * MotionNotify event handler. Only the last motion of a frame
+ * is kept, and reported by mouse_flush().
+ */
+static void event_motion(XEvent *event)
+{
+	XMotionEvent *e = &event->xmotion;
+
+	xw.motioncell = mouse_cell(e->x, e->y);
+	xw.motionstate = e->state;
+	xw.motionpending = True;
+}
+
+/*
+ * ClientMessage event handler.
+ */
+static void event_cmessage(XEvent *event)
+{
+	if (event->xclient.data.l[0] == wmdeletewin_atom) {
+		/* Destroy window */
+		if (tty.pid > 0)
+			kill(tty.pid, SIGHUP);
+		win_close(win, EXIT_SUCCESS);
+	} else if (event->xclient.message_type == xembed_atom && event->xclient.format == 32) {
+		/* XEmbed message */
+		if (event->xclient.data.l[1] == XEMBED_FOCUS_IN) {
+			xw.state |= WIN_FOCUSED;
+			set_urgency(0);
+		} else if (event->xclient.data.l[1] == XEMBED_FOCUS_OUT) {
+			xw.state &= ~WIN_FOCUSED;
+		}
+	}
+}
+
+/*
+ * MapNotify event handler.
+ */
+static void event_map(XEvent *event)
+{
+	if (event->xmap.window == win->frame->win)
+		trace_phase("window mapped");
+}
+
+/*
+ * ConfigureNotify event handler.
+ */
+static void event_resize(XEvent *event)
+{
+	/* Only resize if size was actually changed */
+	if (event->xconfigure.width == xw.width && event->xconfigure.height == xw.height)
+		return;
+
+	resize_all(event->xconfigure.width, event->xconfigure.height);
+}
+
+/*
+ * Expose event handler.
+ */
+static void event_expose(XEvent *event)
+{
+	XExposeEvent *xexpose = &event->xexpose;
+
+	if (xw.state & WIN_REDRAW) {
+		if (xexpose->count == 0)
+			xw.state &= ~WIN_REDRAW;
+	}
+
+	redraw();
+}
+
+static void event_focus(XEvent *event)
+{
+	XFocusChangeEvent *xfocus = &event->xfocus;
+
+	if (xfocus->mode == NotifyGrab)
+		return;
+
+	if (event->type == FocusIn) {
+		xw.state |= WIN_FOCUSED;
+		clock_gettime(CLOCK_MONOTONIC, &xw.blinktime);
+		set_urgency(0);
+		XSetICFocus(xw.xic);
+		DEBUG("FOCUS IN");
+	} else {
+		xw.state &= ~WIN_FOCUSED;
+		XUnsetICFocus(xw.xic);
+		DEBUG("FOCUS OUT");
+	}
+}
+
+/*
+ * UnmapNotify event handler.
+ */
+static void event_unmap(XEvent *event)
+{
+	xwindow_hide();
+}
+
+/*
+ * VisibilityNotify event handler.
+ */
+static void event_visibility(XEvent *event)
+{
+	XVisibilityEvent *xvisibility = &event->xvisibility;
+
+	if (xvisibility->state == VisibilityFullyObscured) {
+		xwindow_hide();
+	} else if (!(xw.state & WIN_VISIBLE)) {
+		/* Window has become visible - flag for redraw */
+		xw.state |= WIN_VISIBLE | WIN_REDRAW;
+	}
+}
+
+/*
+ * SelectionNotify event handler.
+ */
+static void event_selnotify(XEvent *event)
+{
+	XSelectionEvent *xsev;
+	ulong offset, nitems, after;
+	Atom target;
+	int format;
+	uchar *data;
+
+	xsev = &event->xselection;
+
+	if (xsev->property == None) {
+		/* Selection conversion refused */
+		return;
+	}
+
+	/* Get selection contents in chunks */
+	offset = 0L;
+	do {
+		XGetWindowProperty(xw.display, xw.win, xsev->property,
+				offset, BUFSIZ/4, False, (Atom)AnyPropertyType,
+				&target, &format, &nitems, &after, &data);
+
+		if (target != sel.target || target != XA_STRING ||
+				target != text_atom) {
+			/* non-TEXT target */
+			debug(D_WARN, "selection notify: unhandled target 0x%lx",
+					target);
+			break;
+		}
+
+		puts((char *)data);
+
+		XFree(data);
+
+		offset += (nitems * format) / 32;
+	} while (after > 0);
+
+	XDeleteProperty(xsev->display, xsev->requestor, xsev->property);
+}
+
+/*
+ * SelectionRequest event handler.
+ */
+static void event_selrequest(XEvent *event)
+{
+	XSelectionRequestEvent *xsrev;
+	XSelectionEvent xsev;
+	Time timestamp;
+	char *sel_text;
+
+	xsrev = &event->xselectionrequest;
+
+	xsev.type = SelectionNotify;
+	xsev.display = xsrev->display;
+	xsev.requestor = xsrev->requestor;
+	xsev.selection = xsrev->selection;
+	xsev.target = xsrev->target;
+	xsev.time = xsrev->time;
+
+	if (xsrev->property == None) {
+		/* Obsolete requestor */
+		xsrev->property = xsrev->target;
+	}
+
+	if (xsrev->target == timestamp_atom) {
+		/* TIMESTAMP request: return timestamp used to acquire selection */
+		if (xsrev->selection == XA_PRIMARY) {
+			timestamp = sel.sel_time;
+		} else if (xsrev->selection == clipboard_atom) {
+			timestamp = sel.clip_time;
+		} else {
+			debug(D_WARN, "timestamp request: unhandled selection: 0x%lx",
+					xsrev->selection);
+			return;
+			/* FIXME: refuse conversion? */
+		}
+		xsev.property = xsrev->property;
+		XChangeProperty(xsev.display, xsev.requestor, xsev.property,
+				XA_INTEGER, 32, PropModeReplace,
+				(uchar *)timestamp, 1);
+	} else if (xsrev->target == targets_atom) {
+		/* TARGETS request: return list of supported targets */
+		Atom supported[3] = { XA_STRING, text_atom, utf8_atom };
+
+		xsev.property = xsrev->property;
+		XChangeProperty(xsev.display, xsev.requestor, xsev.property,
+				XA_ATOM, 32, PropModeReplace,
+				(uchar *)supported, LEN(supported));
+	} else if (xsrev->target == sel.target || xsrev->target == XA_STRING
+			|| xsrev->target == text_atom) {
+		/* STRING, TEXT request */
+		if (xsrev->selection == XA_PRIMARY) {
+			sel_text = sel.primary;
+		} else if (xsrev->selection == clipboard_atom) {
+			sel_text = sel.clipboard;
+		} else {
+			debug(D_WARN, "text request: unhandled selection: 0x%lx",
+					xsrev->selection);
+			return;
+		}
+		if (sel_text) {
+			xsev.property = xsrev->property;
+			XChangeProperty(xsev.display, xsev.requestor,
+					xsev.property, xsev.target, 8,
+					PropModeReplace, (uchar *)sel_text,
+					sstrlen(sel_text));
+		}
+	} else {
+		/* Refuse conversion to requested target */
+		xsev.property = None;
+	}
+
+	if (!XSendEvent(xsev.display, xsev.requestor,
+				False, (ulong)NULL, (XEvent *)&xsev))
+		debug(D_WARN, "error sending SelectionNotify event");
+}
+
+/*
+ * SelectionClear event handler.
+ */
+static void event_selclear(XEvent *event)
+{
+	/*
+	 * TODO: clear logical & visual selection.
+	 */
+}
+
+static void sc_paste_sel(XKeyEvent *xkey)
+{
+	sel_convert(XA_PRIMARY, xkey->time);
+}
+
+static void sc_paste_clip(XKeyEvent *xkey)
+{
+	sel_convert(clipboard_atom, xkey->time);
+}
+
+static void sc_copy_clip(XKeyEvent *xkey)
+{
+	sel_settext(&sel.clipboard, sel.primary ? strdup(sel.primary) : NULL);
+	if (sel.clipboard != NULL) {
+		if (sel_own(clipboard_atom, xkey->time))
+			sel.clip_time = xkey->time;
+	}
+}
+
+static void sc_hint_copy(XKeyEvent *xkey)
+{
+	hint_start(False, xkey->time);
+}
+
+static void sc_hint_pipe(XKeyEvent *xkey)
+{
+	hint_start(True, xkey->time);
+}
+
+static void sc_scroll_up(XKeyEvent *xkey)
+{
+	view_scroll(MAX(term.rows - 1, 1));
+}
+
+static void sc_scroll_down(XKeyEvent *xkey)
+{
+	view_scroll(-MAX(term.rows - 1, 1));
+}
+
+static void sc_export(XKeyEvent *xkey)
+{
+	export_start(False);
+}
+
+static void sc_export_sgr(XKeyEvent *xkey)
+{
+	export_start(True);
+}
+
+static void sc_tab_new(XKeyEvent *xkey)
+{
+	pane_open(True, False);
+}
+
+static void sc_tab_prev(XKeyEvent *xkey)
+{
+	tab_switch(-1);
+}
+
+static void sc_tab_next(XKeyEvent *xkey)
+{
+	tab_switch(1);
+}
+
+static void sc_split_right(XKeyEvent *xkey)
+{
+	pane_open(False, False);
+}
+
+static void sc_split_down(XKeyEvent *xkey)
+{
+	pane_open(False, True);
+}
+
+static void sc_pane_left(XKeyEvent *xkey)
+{
+	pane_move(-1, 0);
+}
+
+static void sc_pane_right(XKeyEvent *xkey)
+{
+	pane_move(1, 0);
+}
+
+static void sc_pane_up(XKeyEvent *xkey)
+{
+	pane_move(0, -1);
+}
+
+static void sc_pane_down(XKeyEvent *xkey)
+{
+	pane_move(0, 1);
+}
+
+/*
+ * Draw the buffer into the window.
+ */
+static void draw(void)
+{
+	uint64_t start = trace_now();
+	int row;
+
+	/* Keep the dirty rows until the window can be drawn */
+	if (!(xw.state & WIN_VISIBLE) || xw.shmpending)
+		return;
+
+	/* The buffer was released while the window was hidden */
+	if (!xw.shmimg && !xw.drawbuf) {
+		xwindow_buffer();
+		memset(term.drawn, 0, term.rows * sizeof(*term.drawn));
+		term_fulldirty();
+		xw.scrolln = 0;
+	}
+
+	/* Move the rows the screen scrolled, instead of repainting them */
+	if (xw.scrolln) {
+		xwindow_shift(xw.scrolltop, xw.scrollbot, xw.scrolln);
+		xw.scrolln = 0;
+	}
+
+	/* View rows don't follow the dirtiness of screen lines */
+	if (term.scroll)
+		term_fulldirty();
+
+	/* Labels are drawn over the rows: repaint all of them */
+	if (hint.active) {
+		memset(term.drawn, 0, term.rows * sizeof(*term.drawn));
+		term_fulldirty();
+	}
+
+	draw_region(0, 0, term.cols, term.rows);
+	if (hint.active)
+		hint_draw();
+	draw_cursor();
+
+	/* Shifted rows are pushed whole */
+	if (xw.shifted) {
+		term_setdirty(xw.shifttop, xw.shiftbot);
+		xw.shifted = False;
+	}
+	xwindow_put();
+
+	for (row = 0; row < term.rows; row++)
+		term.dirty[row] = False;
+	trace_span("draw", start, NULL, 0);
+}
+
+/*
+ * Copy the internal terminal buffer to the window buffer,
+ * within the specified region. Rows that are still dirty
+ * afterwards are the ones repainted.
+ * TODO
+ */
+static void draw_region(int col1, int row1, int col2, int row2)
+{
+	int row, n = 0;
+	uint64_t fp, start = trace_now();
+
+	/* Check if window is visible */
+	if (!(xw.state & WIN_VISIBLE))
+		return;
+
+	for (row = row1; row < row2; row++) {
+		/* Skip clean lines */
+		if (!term.dirty[row])
+			continue;
+
+		/* Skip lines rewritten the way they were drawn */
+		fp = draw_fingerprint(row);
+		if (fp == term.drawn[row]) {
+			term.dirty[row] = False;
+			continue;
+		}
+		term.drawn[row] = fp;
+		n++;
+
+		/* Repaint the row; draw() resets dirtyness */
+		if (term.scroll && rowcache_load(row))
+			continue;
+		draw_cells(row, 0, term.cols);
+		if (term.scroll)
+			rowcache_store(row);
+	}
+
+	trace_span("draw_region", start, "rows", n);
+	trace_count("dirty rows", n);
+}
+
+/*
+ * Repaint the cells [col1, col2) of a row of the view,
+ * widened to whole wide characters.
+ */
+static void draw_cells(int row, int col1, int col2)
+{
+	Rune *line;
+	ushort *style;
+	long id;
+	int col, end, len = view_line(row, &line, &style, &id);
+
+	col1 = MAX(col1, 0);
+	col2 = MIN(col2, term.cols);
+	if (col1 >= col2)
+		return;
+	if (col1 > 0 && col1 < len && line[col1] == WIDE_TAIL)
+		col1--;
+	if (col2 < len && line[col2] == WIDE_TAIL)
+		col2++;
+
+	xwindow_clear(col1, row, col2 - 1, row);
+
+	/* Cells past the end of a history line are blank */
+	col2 = MIN(col2, len);
+
+	/* Draw runs of characters with the same style */
+	for (col = col1; col < col2; col = end) {
+		/* Wide characters and clusters are drawn on their own */
+		if (IS_CLUSTER(line[col]) || (col + 1 < col2 && line[col+1] == WIDE_TAIL)) {
+			end = col + 1;
+			if (end < col2 && line[end] == WIDE_TAIL)
+				end++;
+			draw_run(col, row, line + col, end - col, &term.styles[style[col]].style);
+			continue;
+		}
+		for (end = col + 1; end < col2; end++) {
+			if (style[end] != style[col] || IS_CLUSTER(line[end]) ||
+					(end + 1 < col2 && line[end+1] == WIDE_TAIL))
+				break;
+		}
+		draw_run(col, row, line + col, end - col, &term.styles[style[col]].style);
+	}
+}
+
+/*
+ * Cells of a row of the view: a history line while the view is
+ * scrolled back over it, a screen line otherwise. Returns the number
+ * of cells, and sets id to the number of the history line, or -1.
+ */
+static int view_line(int row, Rune **line, ushort **style, long *id)
+{
+	long n = term.histno - term.scroll + row;
+	int len = term_line(n, line, style);
+
+	*id = (n < term.histno) ? n : -1;
+	return MIN(len, term.cols);
+}
+
+/*
+ * Scroll the view n lines back into history, or forward for negative
+ * n. The drawing buffer is shifted along, so that only the rows coming
+ * into view are drawn.
+ */
+static void view_scroll(int n)
+{
+	int scroll = term.scroll + n;
+
+	if (hint.active)
+		return;
+	LIMIT(scroll, 0, term_histcount());
+	if ((n = scroll - term.scroll) == 0)
+		return;
+
+	term.scroll = scroll;
+	if (xw.scrolln) {
+		xwindow_shift(xw.scrolltop, xw.scrollbot, xw.scrolln);
+		xw.scrolln = 0;
+	}
+	xwindow_shift(0, term.rows - 1, n);
+	term_fulldirty();
+}
+
+/*
+ * Copy a history row of the view from the row cache into drawbuf.
+ * Returns False if it isn't cached. The cache only serves core X
+ * drawing, where rendering a row costs requests to the server.
+ */
+static Bool rowcache_load(int row)
+{
+	Rune *line;
+	ushort *style;
+	long id;
+	int i;
+
+	view_line(row, &line, &style, &id);
+	if (id < 0 || !xw.cache)
+		return False;
+
+	for (i = 0; i < row_cache; i++) {
+		if (xw.cache[i].line == id) {
+			XCopyArea(xw.display, xw.cachepix, xw.drawbuf, dc.gc,
+					0, i * xw.ch, xw.width, xw.ch, 0, xw.border + row * xw.ch);
+			xw.cache[i].used = ++xw.cacheclock;
+			return True;
+		}
+	}
+	return False;
+}
+
+/*
+ * Keep the history row just drawn in the row cache,
+ * in place of the least recently used one.
+ */
+static void rowcache_store(int row)
+{
+	Rune *line;
+	ushort *style;
+	long id;
+	int i, slot = 0;
+
+	view_line(row, &line, &style, &id);
+	if (id < 0 || !xw.drawbuf || row_cache <= 0)
+		return;
+
+	if (!xw.cache) {
+		if (!(xw.cache = malloc(row_cache * sizeof(*xw.cache))))
+			die("malloc failed: %s", strerror(errno));
+		for (i = 0; i < row_cache; i++)
+			xw.cache[i] = (RowCache){ .line = -1, .used = 0 };
+		xw.cachepix = XCreatePixmap(xw.display, xw.win, xw.width,
+				row_cache * xw.ch, DefaultDepth(xw.display, xw.screen));
+		xw.cachemem = pixmap_size(xw.width, row_cache * xw.ch);
+		mem_add(MEM_GLYPHS, row_cache * sizeof(*xw.cache));
+		mem_add(MEM_PIXMAPS, xw.cachemem);
+	}
+
+	for (i = 1; i < row_cache; i++) {
+		if (xw.cache[i].used < xw.cache[slot].used)
+			slot = i;
+	}
+	XCopyArea(xw.display, xw.drawbuf, xw.cachepix, dc.gc,
+			0, xw.border + row * xw.ch, xw.width, xw.ch, 0, slot * xw.ch);
+	xw.cache[slot] = (RowCache){ .line = id, .used = ++xw.cacheclock };
+}
+
+/*
+ * Draw the cursor over the cells, if it moved or changed shape since
+ * the last frame or its row was repainted. Only the cells around the
+ * old cursor are repainted and pushed to the window, so a blink costs
+ * a single cell.
+ */
+static void draw_cursor(void)
+{
+	Coord c = term.cursor, old = xw.curdrawn;
+	Rune *line = term.line[c.y];
+	int shape, x, y, bw, cw, ch = xw.ch;
+	Style st;
+	ulong fg;
+	Bool moved;
+
+	c.x = MIN(c.x, term.cols - 1);
+	if (c.x > 0 && line[c.x] == WIDE_TAIL)
+		c.x--;
+	shape = cursor_shape(NULL);
+	/* Row of the view, which may be scrolled back past the cursor */
+	if ((c.y += term.scroll) >= term.rows)
+		shape = CURSOR_NONE;
+	moved = (shape != xw.curshape || c.x != old.x || c.y != old.y);
+
+	/* Erase the old cursor, along with the glyphs overlapping its cell */
+	if (xw.curshape != CURSOR_NONE && moved && old.y < term.rows &&
+			!term.dirty[old.y]) {
+		draw_cells(old.y, old.x - 1, old.x + 2);
+		xwindow_copy(xw.border + MAX(old.x - 1, 0) * xw.cw,
+				xw.border + old.y * ch, 3 * xw.cw, ch);
+	}
+
+	xw.curdrawn = c;
+	xw.curshape = shape;
+	if (shape == CURSOR_NONE || (!moved && !term.dirty[c.y]))
+		return;
+
+	st = term.styles[term.style[term.cursor.y][c.x]].style;
+	if ((st.attr & ATTR_BOLD) && st.fg < 8)
+		st.fg += 8;
+	fg = xpixel((st.attr & ATTR_REVERSE) ? st.bg : st.fg);
+	cw = (c.x + 1 < term.cols && line[c.x+1] == WIDE_TAIL) ? 2 * xw.cw : xw.cw;
+	bw = MAX(1, xw.cw / 6);
+	x = xw.border + c.x * xw.cw;
+	y = xw.border + c.y * ch;
+
+	switch (shape) {
+	case CURSOR_BLOCK:
+		st.attr ^= ATTR_REVERSE;
+		draw_run(c.x, c.y, line + c.x, cw / xw.cw, &st);
+		break;
+	case CURSOR_UNDERLINE:
+		xwindow_fill(x, y + ch - bw, cw, bw, fg);
+		break;
+	case CURSOR_BAR:
+		xwindow_fill(x, y, bw, ch, fg);
+		break;
+	case CURSOR_HOLLOW:
+		xwindow_fill(x, y, cw, 1, fg);
+		xwindow_fill(x, y + ch - 1, cw, 1, fg);
+		xwindow_fill(x, y, 1, ch, fg);
+		xwindow_fill(x + cw - 1, y, 1, ch, fg);
+		break;
+	}
+
+	if (!term.dirty[c.y])
+		xwindow_copy(x, y, cw, ch);
+}
+
+/*
+ * Shape the cursor is drawn with at time now, NULL for the current
+ * time. A blinking cursor is on for blink_time ms after input or
+ * output, then off as long, and stays on once the window is idle for
+ * blink_idle ms.
+ */
+static int cursor_shape(struct timespec *now)
+{
+	static const int shapes[] = {
+		CURSOR_BLOCK, CURSOR_BLOCK, CURSOR_BLOCK, CURSOR_UNDERLINE,
+		CURSOR_UNDERLINE, CURSOR_BAR, CURSOR_BAR,
+	};
+	int style = term.cursorstyle ? term.cursorstyle : cursor_style;
+	struct timespec ts;
+	double t;
+
+	if (term.mode & MODE_HIDE)
+		return CURSOR_NONE;
+	if (!(xw.state & WIN_FOCUSED))
+		return CURSOR_HOLLOW;
+
+	if (!now) {
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+		now = &ts;
+	}
+	t = TIMEDIFF(*now, xw.blinktime);
+	if ((style & 1) && blink_time > 0 && t < blink_idle && (long)(t / blink_time) % 2)
+		return CURSOR_NONE;
+
+	return shapes[style];
+}
+
+/*
+ * Time (ms) until the cursor blinks, or -1 if it doesn't:
+ * a hidden, unfocused or idle window does no periodic work.
+ */
+static double cursor_wait(struct timespec *now)
+{
+	int style = term.cursorstyle ? term.cursorstyle : cursor_style;
+	double t = TIMEDIFF(*now, xw.blinktime);
+
+	if (!(xw.state & WIN_VISIBLE) || !(xw.state & WIN_FOCUSED) ||
+			(term.mode & MODE_HIDE) || !(style & 1) || blink_time <= 0 ||
+			t >= blink_idle)
+		return -1;
+
+	return MIN(blink_time - (t - (long)(t / blink_time) * blink_time), blink_idle - t);
+}
+
+/*
+ * Draw len cells with the given style into the window buffer.
+ */
+static void draw_run(int col, int row, Rune *s, int len, Style *style)
+{
+	uint fg = style->fg, bg = style->bg, tmp;
+	int x = xw.border + col * xw.cw;
+	int y = xw.border + row * xw.ch + dc.font.ascent;
+	char buf[len * UTF_SIZ];
+	const Rune *rs;
+	int i, n;
+
+	/* Bold text uses the bright colors */
+	if ((style->attr & ATTR_BOLD) && fg < 8)
+		fg += 8;
+	if (style->attr & ATTR_REVERSE) {
+		tmp = fg;
+		fg = bg;
+		bg = tmp;
+	}
+
+	if (xw.shmimg) {
+		shm_draw(x, y - dc.font.ascent, s, len, xpixel(fg), xpixel(bg),
+				style->attr & ATTR_UNDERLINE);
+		return;
+	}
+
+	XSetForeground(xw.display, dc.gc, xpixel(fg));
+	XSetBackground(xw.display, dc.gc, xpixel(bg));
+	if (IS_CLUSTER(*s)) {
+		/* Overstrike the code points of a cluster in its cell */
+		rs = cell_runes(s, &n);
+		Xutf8DrawImageString(xw.display, xw.drawbuf, dc.font.font_set,
+				dc.gc, x, y, buf, utf8_encode(rs[0], buf));
+		for (i = 1; i < n; i++)
+			Xutf8DrawString(xw.display, xw.drawbuf, dc.font.font_set,
+					dc.gc, x, y, buf, utf8_encode(rs[i], buf));
+	} else {
+		Xutf8DrawImageString(xw.display, xw.drawbuf, dc.font.font_set,
+				dc.gc, x, y, buf, utf8_string(s, len, buf));
+	}
+
+	if (style->attr & ATTR_UNDERLINE)
+		XDrawLine(xw.display, xw.drawbuf, dc.gc, x, y + 1,
+				x + len * xw.cw - 1, y + 1);
+}
+
+/*
+ * Force a complete redraw of the window.
+ */
+static void redraw(void)
+{
+	memset(term.drawn, 0, term.rows * sizeof(*term.drawn));
+	term_fulldirty();
+	draw();
+}
+
+/*
+ * Get the fingerprint of a row as it would be drawn: its characters
+ * and their styles, resolved since style indices and clusters are
+ * reused. Never 0.
+ */
+static uint64_t draw_fingerprint(int row)
+{
+	const Rune *rs;
+	Rune *line;
+	ushort *style;
+	Style *st;
+	uint64_t h = 0xcbf29ce484222325ULL;
+	long id;
+	int x, i, n, len = view_line(row, &line, &style, &id);
+
+#define MIX(v)	(h = (h ^ (v)) * 0x100000001b3ULL, h ^= h >> 32)
+	MIX(len);
+	for (x = 0; x < len; x++) {
+		rs = cell_runes(&line[x], &n);
+		for (i = 0; i < n; i++)
+			MIX(rs[i]);
+		st = &term.styles[style[x]].style;
+		MIX(st->fg);
+		MIX(st->bg);
+		MIX(st->attr);
+	}
+#undef MIX
+
+	return h | 1;
+}
+
+/*
+ * Put a character at the cursor position, interpreting
+ * the control characters that move the cursor.
+ */
+static void term_putc(char c)
+{
+	uchar u = c;
+
+	/* Continuation of a UTF-8 sequence, or the byte that breaks it.
+	 * After F4, only 80..8F continue: the rest go past U+10FFFF. */
+	if (term.utf8len > 0) {
+		if ((u & 0xc0) == 0x80 && (term.utf8len < 3 ||
+				(term.utf8 << 6 | (u & 0x3f)) <= 0x10ffff >> 12)) {
+			term.utf8 = term.utf8 << 6 | (u & 0x3f);
+			if (--term.utf8len > 0)
+				return;
+			/* Reject overlong forms and surrogates */
+			if (term.utf8 < term.utf8min || BETWEEN(term.utf8, 0xd800, 0xdfff))
+				term.utf8 = UTF_INVALID;
+			term_putrune(term.utf8);
+			return;
+		}
+		term.utf8len = 0;
+		term_putrune(UTF_INVALID);
+	}
+
+	/* Escape sequences, within which control characters still act */
+	if (term.esc == ESC_START && !ISCONTROL(c)) {
+		term.esc = ESC_NONE;
+		switch (c) {
+		case '[':
+			term.esc = ESC_CSI;
+			term.csi.len = 0;
+			break;
+		case ']':
+			term.esc = ESC_OSC;
+			term.osc.state = OSC_ARG;
+			term.osc.arglen = 0;
+			break;
+		case '=':	/* DECKPAM - application keypad */
+			term.mode |= MODE_APPKEYPAD;
+			break;
+		case '>':	/* DECKPNM - numeric keypad */
+			term.mode &= ~MODE_APPKEYPAD;
+			break;
+		case 'D':	/* IND - index */
+			term_newline();
+			break;
+		case 'M':	/* RI - reverse index */
+			if (term.cursor.y == term.top)
+				term_scroll(term.top, term.bot, -1);
+			else
+				term_moveto(term.cursor.x, term.cursor.y - 1);
+			break;
+		}
+		return;
+	} else if (term.esc == ESC_CSI && !ISCONTROL(c)) {
+		term.csi.buf[term.csi.len++] = c;
+		if (BETWEEN(c, 0x40, 0x7e) || term.csi.len == CSI_BUF_SIZ-1) {
+			term.esc = ESC_NONE;
+			csi_parse();
+			csi_handle();
+		}
+		return;
+	} else if (term.esc == ESC_OSC) {
+		if (!ISCONTROL(c)) {
+			osc_put(&c, 1);
+			return;
+		}
+		/* Other control characters are ignored within */
+		if (c != '\a' && c != '\033' && c != '\030' && c != '\032')
+			return;
+		osc_end(c);
+		term.esc = ESC_NONE;
+		if (c == '\a')
+			return;
+	}
+
+	switch (c) {
+	case '\033':
+		term.esc = ESC_START;
+		return;
+	case '\030':	/* CAN */
+	case '\032':	/* SUB */
+		term.esc = ESC_NONE;
+		return;
+	case '\n':
+	case '\v':
+	case '\f':
+		term_newline();
+		return;
+	case '\r':
+		term_moveto(0, term.cursor.y);
+		return;
+	case '\b':
+		term_moveto(term.cursor.x - 1, term.cursor.y);
+		return;
+	case '\t':
+		term_moveto((term.cursor.x + 8) & ~7, term.cursor.y);
+		return;
+	case '\a':
+		if (!win->frame->focused)
+			set_urgency(1);
+		return;
+	}
+
+	/* Ignore remaining control characters */
+	if (ISCONTROL(c))
+		return;
+
+	/* Start of a UTF-8 sequence */
+	if (u >= 0x80) {
+		if ((u & 0xe0) == 0xc0) {
+			term.utf8 = u & 0x1f;
+			term.utf8len = 1;
+			term.utf8min = 0x80;
+		} else if ((u & 0xf0) == 0xe0) {
+			term.utf8 = u & 0x0f;
+			term.utf8len = 2;
+			term.utf8min = 0x800;
+		} else if ((u & 0xf8) == 0xf0 && u <= 0xf4) {
+			term.utf8 = u & 0x07;
+			term.utf8len = 3;
+			term.utf8min = 0x10000;
+		} else {
+			term_putrune(UTF_INVALID);
+		}
+		return;
+	}
+
+	term_putrune(u);
+}
+
+/*
+ * Put a printable character at the cursor position. Wide characters
+ * take two cells, the second of which holds WIDE_TAIL.
+ */
+static void term_putrune(Rune r)
+{
+	Rune *line;
+	int x, width = UNI_WIDTH(uniprop(r));
+
+	/* Characters that extend the cluster left of the cursor join its cell */
+	x = term.wrapnext ? term.cursor.x : term.cursor.x - 1;
+	line = term.line[term.cursor.y];
+	if (x > 0 && line[x] == WIDE_TAIL)
+		x--;
+	if (x >= 0 && term_extends(line[x], r)) {
+		line[x] = cluster_add(line[x], r);
+		term.dirty[term.cursor.y] = True;
+		term.lm[term.cursor.y].dirty = True;
+		return;
+	}
+
+	/* Other zero width characters (and C1 controls) are dropped */
+	if (width == 0 || width > term.cols)
+		return;
+
+	if (term.wrapnext || term.cursor.x + width > term.cols) {
+		term_moveto(0, term.cursor.y);
+		term_newline();
+	}
+
+	x = term.cursor.x;
+	line = term.line[term.cursor.y];
+	/* Don't leave half of a wide character behind */
+	if (line[x] == WIDE_TAIL && x > 0)
+		cell_set(&line[x-1], ' ');
+	if (x + width < term.cols && line[x + width] == WIDE_TAIL)
+		line[x + width] = ' ';
+
+	cell_set(&line[x], r);
+	style_set(&term.style[term.cursor.y][x], term.penidx);
+	if (width == 2) {
+		cell_set(&line[x+1], WIDE_TAIL);
+		style_set(&term.style[term.cursor.y][x+1], term.penidx);
+	}
+	term.dirty[term.cursor.y] = True;
+	term.lm[term.cursor.y].dirty = True;
+
+	if (x + width == term.cols)
+		term.wrapnext = True;
+	else
+		term_moveto(x + width, term.cursor.y);
+}
+
+/*
+ * Check if a character continues the grapheme cluster of a cell
+ * (UAX #29, without the rules that look further back than the last
+ * code point).
+ */
+static Bool term_extends(Rune cell, Rune r)
+{
+	const Rune *rs;
+	int n;
+	uint prop = uniprop(r), last;
+
+	rs = cell_runes(&cell, &n);
+	last = UNI_GB(uniprop(rs[n-1]));
+
+	switch (UNI_GB(prop)) {
+	case GB_EXTEND:
+	case GB_ZWJ:
+	case GB_SPACINGMARK:
+		return True;
+	case GB_REGIONAL_INDICATOR:
+		/* Flags are pairs of regional indicators */
+		return n == 1 && last == GB_REGIONAL_INDICATOR;
+	case GB_L:
+	case GB_LV:
+	case GB_LVT:
+		return last == GB_L;
+	case GB_V:
+		return last == GB_L || last == GB_V || last == GB_LV;
+	case GB_T:
+		return last == GB_V || last == GB_T || last == GB_LV || last == GB_LVT;
+	case GB_CONTROL:
+	case GB_CR:
+	case GB_LF:
+		return False;
+	}
+
+	/* Emoji joined by ZWJ, and characters after a prepended mark */
+	return last == GB_PREPEND || (last == GB_ZWJ && UNI_EXTPICT(prop));
+}
+
+/*
+ * Get the code points of a cell.
+ */
+static const Rune *cell_runes(const Rune *cell, int *n)
+{
+	Cluster *c;
+
+	if (!IS_CLUSTER(*cell)) {
+		*n = 1;
+		return cell;
+	}
+	c = &term.cluster[*cell & ~CLUSTER_BIT];
+	*n = c->n;
+	return c->r;
+}
+
+/*
+ * Set a cell, releasing the cluster it referred to.
+ */
+static void cell_set(Rune *cell, Rune r)
+{
+	cell_release(cell, 1);
+	*cell = r;
+}
+
+/*
+ * Release the clusters referred to by n cells. Clusters are freed
+ * when their last cell goes.
+ */
+static void cell_release(Rune *cell, int n)
+{
+	Cluster *c;
+	int i;
+
+	for (i = 0; i < n; i++) {
+		if (!IS_CLUSTER(cell[i]))
+			continue;
+		c = &term.cluster[cell[i] & ~CLUSTER_BIT];
+		if (--c->refs == 0) {
+			c->next = term.freecluster;
+			term.freecluster = c - term.cluster;
+		}
+		cell[i] = ' ';
+	}
+}
+
+/*
+ * Add a code point to the cluster of a cell, and get the new value of
+ * the cell. Clusters shared with other cells are copied first.
+ */
+static Rune cluster_add(Rune cell, Rune r)
+{
+	Cluster *c;
+	int i;
+
+	if (IS_CLUSTER(cell)) {
+		c = &term.cluster[cell & ~CLUSTER_BIT];
+		if (c->n == CLUSTER_MAX)
+			return cell;
+		if (c->refs == 1) {
+			c->r[c->n++] = r;
+			return cell;
+		}
+	}
+
+	/* Take a free cluster, growing the table if there is none */
+	if (term.freecluster < 0) {
+		i = term.ncluster;
+		term.ncluster = term.ncluster ? 2 * term.ncluster : 16;
+		term.cluster = realloc(term.cluster, term.ncluster * sizeof(*term.cluster));
+		mem_add(MEM_SCREEN, (term.ncluster - i) * sizeof(*term.cluster));
+		for (; i < term.ncluster; i++) {
+			term.cluster[i].refs = 0;
+			term.cluster[i].next = term.freecluster;
+			term.freecluster = i;
+		}
+	}
+	i = term.freecluster;
+	term.freecluster = term.cluster[i].next;
+
+	if (IS_CLUSTER(cell)) {
+		c = &term.cluster[cell & ~CLUSTER_BIT];
+		term.cluster[i] = *c;
+		c->refs--;
+	} else {
+		term.cluster[i].r[0] = cell;
+		term.cluster[i].n = 1;
+	}
+	c = &term.cluster[i];
+	c->refs = 1;
+	c->r[c->n++] = r;
+
+	return CLUSTER_BIT | i;
+}
+
+static uint style_hash(Style *style)
+{
+	uint h = (style->fg * 31 + style->bg) * 31 + style->attr;
+
+	/* Chains are picked by the low bits: mix the high ones in */
+	h ^= h >> 16;
+	h *= 0x85ebca6b;
+	return h ^ h >> 13;
+}
+
+/*
+ * Double the style table. There are as many hash chains as styles,
+ * so that they stay short, and the styles in use are linked again.
+ */
+static void style_grow(void)
+{
+	StyleEntry *e;
+	int i, n = term.nstyles;
+	uint h;
+
+	term.nstyles = n ? MIN(2 * n, STYLE_MAX) : 16;
+	if (!(term.styles = realloc(term.styles, term.nstyles * sizeof(*term.styles))) ||
+			!(term.stylehash = realloc(term.stylehash,
+				term.nstyles * sizeof(*term.stylehash))))
+		die("realloc failed: %s", strerror(errno));
+	mem_add(MEM_SCREEN, (term.nstyles - n) *
+			(long)(sizeof(*term.styles) + sizeof(*term.stylehash)));
+
+	for (i = 0; i < term.nstyles; i++)
+		term.stylehash[i] = -1;
+	/* New styles are freed lowest first, which makes the first style
+	 * (the default) 0 */
+	for (i = term.nstyles - 1; i >= 0; i--) {
+		e = &term.styles[i];
+		if (i >= n) {
+			e->refs = 0;
+			e->next = term.freestyle;
+			term.freestyle = i;
+		} else if (e->refs > 0) {
+			h = style_hash(&e->style) & (term.nstyles - 1);
+			e->next = term.stylehash[h];
+			term.stylehash[h] = i;
+		}
+	}
+}
+
+/*
+ * Get the index of a style in the style table, adding it if needed,
+ * and take a reference to it. History keeps styles alive, so 24-bit
+ * colors may use up the table: they then fall back to the nearest
+ * colors of the color cube, and once the table is full, to the
+ * default style.
+ */
+static ushort style_intern(Style *style)
+{
+	StyleEntry *e;
+	Style cube;
+	uint h = style_hash(style);
+	int i;
+
+	for (i = term.stylehash[h & (term.nstyles - 1)]; i >= 0; i = e->next) {
+		e = &term.styles[i];
+		if (e->style.fg == style->fg && e->style.bg == style->bg &&
+				e->style.attr == style->attr) {
+			if (i)
+				e->refs++;
+			return i;
+		}
+	}
+
+	if (IS_TRUECOLOR(style->fg | style->bg) &&
+			term.usedstyles >= STYLE_MAX - STYLE_RESERVE) {
+		if (!term.stylefull)
+			debug(D_WARN, "style table full, using the color cube");
+		term.stylefull = True;
+		cube = (Style){ .fg = color_cube(style->fg), .bg = color_cube(style->bg),
+			.attr = style->attr };
+		return style_intern(&cube);
+	}
+
+	/* Take a free style, growing the table if there is none */
+	if (term.freestyle < 0) {
+		if (term.nstyles == STYLE_MAX) {
+			if (!term.stylefull)
+				debug(D_WARN, "style table full, using the default style");
+			term.stylefull = True;
+			return 0;
+		}
+		style_grow();
+	}
+	i = term.freestyle;
+	e = &term.styles[i];
+	term.freestyle = e->next;
+	term.usedstyles++;
+
+	e->style = *style;
+	e->refs = 1;
+	h &= term.nstyles - 1;
+	e->next = term.stylehash[h];
+	term.stylehash[h] = i;
+
+	return i;
+}
+
+/*
+ * Set the style of a cell, moving the reference from its old style.
+ */
+static void style_set(ushort *cell, ushort idx)
+{
+	if (*cell == idx)
+		return;
+	style_release(cell, 1);
+	*cell = idx;
+	if (idx)
+		term.styles[idx].refs++;
+}
+
+/*
+ * Drop the references of n cells to their styles, which become the
+ * default style. Styles are freed when their last reference goes.
+ */
+static void style_release(ushort *cell, int n)
+{
+	StyleEntry *e;
+	int i, *p;
+
+	for (i = 0; i < n; i++) {
+		if (cell[i] == 0)
+			continue;
+		e = &term.styles[cell[i]];
+		if (--e->refs == 0) {
+			/* Unlink from its hash chain, and free */
+			for (p = &term.stylehash[style_hash(&e->style) & (term.nstyles - 1)];
+					*p != cell[i]; p = &term.styles[*p].next)
+				;
+			*p = e->next;
+			e->next = term.freestyle;
+			term.freestyle = cell[i];
+			term.usedstyles--;
+		}
+		cell[i] = 0;
+	}
+}
+
+/*
+ * Intern the pen after it changed.
+ */
+static void term_setpen(void)
+{
+	ushort old = term.penidx;
+
+	term.penidx = style_intern(&term.pen);
+	style_release(&old, 1);
+}
+
+/*
+ * Split the collected CSI sequence into its arguments and mode.
+ */
+static void csi_parse(void)
+{
+	CSIEscape *csi = &term.csi;
+	char *p = csi->buf, *end;
+	long v;
+
+	csi->buf[csi->len] = '\0';
+	csi->narg = 0;
+	/* Missing arguments are 0 */
+	memset(csi->arg, 0, sizeof(csi->arg));
+	csi->priv = (*p == '?' || *p == '>') ? *p : 0;
+	if (csi->priv)
+		p++;
+
+	while (p < csi->buf + csi->len - 1) {
+		v = strtol(p, &end, 10);
+		if (end == p || v < 0)
+			v = 0;
+		else if (v > USHRT_MAX)
+			v = USHRT_MAX;
+		if (csi->narg < CSI_ARG_SIZ)
+			csi->arg[csi->narg++] = v;
+		p = end;
+		if (*p != ';')
+			break;
+		p++;
+	}
+	csi->mode = csi->buf[csi->len - 1];
+	csi->inter = (csi->len >= 2 && BETWEEN(csi->buf[csi->len - 2], 0x20, 0x2f)) ?
+		csi->buf[csi->len - 2] : 0;
+}
+
+/*
+ * Perform the parsed CSI sequence.
+ */
+static void csi_handle(void)
+{
+	CSIEscape *csi = &term.csi;
+	int n = DEFAULT(csi->arg[0], 1);
+
+	/* Editing and movement take no private marker or intermediate */
+	if (!csi->priv && !csi->inter) {
+		switch (csi->mode) {
+		case 'H':	/* CUP - move cursor */
+		case 'f':	/* HVP */
+			term_moveto(DEFAULT(csi->arg[1], 1) - 1, n - 1);
+			return;
+		case '@':	/* ICH - insert blank characters */
+			term_insertblank(n);
+			return;
+		case 'P':	/* DCH - delete characters */
+			term_deletechar(n);
+			return;
+		case 'X':	/* ECH - erase characters */
+			term_erasechar(n);
+			return;
+		case 'L':	/* IL - insert lines */
+		case 'M':	/* DL - delete lines */
+			if (BETWEEN(term.cursor.y, term.top, term.bot)) {
+				term_scroll(term.cursor.y, term.bot, (csi->mode == 'L') ? -n : n);
+				term_moveto(0, term.cursor.y);
+			}
+			return;
+		case 'S':	/* SU - scroll up */
+			term_scroll(term.top, term.bot, n);
+			return;
+		case 'T':	/* SD - scroll down */
+			if (csi->narg <= 1)
+				term_scroll(term.top, term.bot, -n);
+			return;
+		case 'r':	/* DECSTBM - set scroll region */
+			n = DEFAULT(csi->arg[1], term.rows);
+			if (DEFAULT(csi->arg[0], 1) < n && n <= term.rows) {
+				term.top = DEFAULT(csi->arg[0], 1) - 1;
+				term.bot = n - 1;
+				term_moveto(0, 0);
+			}
+			return;
+		}
+	}
+
+	switch (csi->mode) {
+	case 'm':	/* SGR - set graphic rendition */
+		if (!csi->priv && !csi->inter) {
+			term_setattr(csi->arg, csi->narg);
+			term_setpen();
+		} else if (csi->priv == '>' && csi->narg > 0 && csi->arg[0] == 4) {
+			/* xterm modifyOtherKeys */
+			term.modkeys = (csi->narg > 1) ? MIN(csi->arg[1], 2) : 0;
+		}
+		break;
+	case 'h':	/* SM - set mode */
+	case 'l':	/* RM - reset mode */
+		if (!csi->inter && csi->priv != '>')
+			term_setmode(csi->priv, csi->mode == 'h', csi->arg, csi->narg);
+		break;
+	case 'p':
+		/* DECRQM - request mode */
+		if (csi->inter == '$' && csi->priv != '>' && csi->narg > 0)
+			term_reportmode(csi->priv, csi->arg[0]);
+		break;
+	case 'q':
+		/* DECSCUSR - set cursor style */
+		if (csi->inter == ' ' && !csi->priv && csi->narg > 0 && csi->arg[0] <= 6)
+			term.cursorstyle = csi->arg[0];
+		break;
+	}
+}
+
+/*
+ * Set or reset modes from SM/RM arguments.
+ */
+static void term_setmode(Bool priv, Bool set, int *arg, int narg)
+{
+	int i;
+
+	for (i = 0; i < narg; i++) {
+		if (!priv)
+			continue;
+		switch (arg[i]) {
+		case 1:		/* DECCKM - application cursor keys */
+			MODBIT(term.mode, set, MODE_APPCURSOR);
+			break;
+		case 66:	/* DECNKM - application keypad */
+			MODBIT(term.mode, set, MODE_APPKEYPAD);
+			break;
+		case 1000:	/* mouse tracking: buttons */
+		case 1002:	/* buttons and drags */
+		case 1003:	/* buttons and all motion */
+			term.mode &= ~MODE_MOUSE;
+			if (set)
+				term.mode |= (arg[i] == 1000) ? MODE_MOUSEBTN :
+					(arg[i] == 1002) ? MODE_MOUSEDRAG : MODE_MOUSEMOTION;
+			xw.mousecell = (Coord){ .x = -1, .y = -1 };
+			mouse_select();
+			break;
+		case 1006:	/* SGR mouse encoding */
+			MODBIT(term.mode, set, MODE_MOUSESGR);
+			break;
+		case 25:	/* DECTCEM - show cursor */
+			MODBIT(term.mode, !set, MODE_HIDE);
+			break;
+		case 2026:	/* synchronized output */
+			/* Setting it again doesn't extend sync_timeout */
+			if (set && !(term.mode & MODE_SYNC))
+				clock_gettime(CLOCK_MONOTONIC, &term.synctime);
+			MODBIT(term.mode, set, MODE_SYNC);
+			break;
+		}
+	}
+}
+
+/*
+ * Answer DECRQM: 1 if the mode is set, 2 if it is reset,
+ * 0 if it is not recognized.
+ */
+static void term_reportmode(Bool priv, int mode)
+{
+	char buf[32];
+	int state = 0;
+
+	if (priv) {
+		switch (mode) {
+		case 1:
+			state = (term.mode & MODE_APPCURSOR) ? 1 : 2;
+			break;
+		case 66:
+			state = (term.mode & MODE_APPKEYPAD) ? 1 : 2;
+			break;
+		case 1000:
+			state = (term.mode & MODE_MOUSEBTN) ? 1 : 2;
+			break;
+		case 1002:
+			state = (term.mode & MODE_MOUSEDRAG) ? 1 : 2;
+			break;
+		case 1003:
+			state = (term.mode & MODE_MOUSEMOTION) ? 1 : 2;
+			break;
+		case 1006:
+			state = (term.mode & MODE_MOUSESGR) ? 1 : 2;
+			break;
+		case 25:
+			state = (term.mode & MODE_HIDE) ? 2 : 1;
+			break;
+		case 2026:
+			state = (term.mode & MODE_SYNC) ? 1 : 2;
+			break;
+		}
+	}
+
+	snprintf(buf, sizeof(buf), "\033[%s%d;%d$y", priv ? "?" : "", mode, state);
+	tty_write(buf, strlen(buf));
+}
+
+/*
+ * Set the style of printed characters from SGR arguments.
+ */
+static void term_setattr(int *arg, int narg)
+{
+	int i, color;
+
+	/* No arguments is the same as 0 */
+	if (narg == 0) {
+		term.pen = (Style){ .fg = color_fg, .bg = color_bg, .attr = 0 };
+		return;
+	}
+
+	for (i = 0; i < narg; i++) {
+		switch (arg[i]) {
+		case 0:
+			term.pen = (Style){ .fg = color_fg, .bg = color_bg, .attr = 0 };
+			break;
+		case 1:
+			term.pen.attr |= ATTR_BOLD;
+			break;
+		case 4:
+			term.pen.attr |= ATTR_UNDERLINE;
+			break;
+		case 7:
+			term.pen.attr |= ATTR_REVERSE;
+			break;
+		case 22:
+			term.pen.attr &= ~ATTR_BOLD;
+			break;
+		case 24:
+			term.pen.attr &= ~ATTR_UNDERLINE;
+			break;
+		case 27:
+			term.pen.attr &= ~ATTR_REVERSE;
+			break;
+		case 38:
+			if ((color = sgr_color(arg, narg, &i)) >= 0)
+				term.pen.fg = color;
+			break;
+		case 39:
+			term.pen.fg = color_fg;
+			break;
+		case 48:
+			if ((color = sgr_color(arg, narg, &i)) >= 0)
+				term.pen.bg = color;
+			break;
+		case 49:
+			term.pen.bg = color_bg;
+			break;
+		default:
+			if (BETWEEN(arg[i], 30, 37))
+				term.pen.fg = arg[i] - 30;
+			else if (BETWEEN(arg[i], 40, 47))
+				term.pen.bg = arg[i] - 40;
+			else if (BETWEEN(arg[i], 90, 97))
+				term.pen.fg = arg[i] - 90 + 8;
+			else if (BETWEEN(arg[i], 100, 107))
+				term.pen.bg = arg[i] - 100 + 8;
+			break;
+		}
+	}
+}
+
+/*
+ * Parse the color of an SGR 38/48 argument at arg[*i]: either
+ * "5;n" (palette) or "2;r;g;b" (24-bit). *i is moved to the last
+ * argument used. Returns the color, or -1 if it is invalid.
+ */
+static int sgr_color(int *arg, int narg, int *i)
+{
+	int r, g, b;
+
+	if (*i + 2 < narg && arg[*i+1] == 5) {
+		*i += 2;
+		return (arg[*i] <= 255) ? arg[*i] : -1;
+	} else if (*i + 4 < narg && arg[*i+1] == 2) {
+		r = arg[*i+2];
+		g = arg[*i+3];
+		b = arg[*i+4];
+		*i += 4;
+		if (r > 255 || g > 255 || b > 255)
+			return -1;
+		return TRUECOLOR(r, g, b);
+	}
+	return -1;
+}
+
+#ifdef __SSE2__
+/*
+ * Bytes of c between lo and hi, which are both below 0x80.
+ */
+static inline __m128i b64_range(__m128i c, char lo, char hi)
+{
+	return _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8(lo - 1)),
+			_mm_cmplt_epi8(c, _mm_set1_epi8(hi + 1)));
+}
+
+/*
+ * Decode sixteen base64 characters of s into twelve bytes at out.
+ * Returns False, leaving out alone, if one of them isn't in the
+ * alphabet.
+ */
+static inline Bool b64_decode16(const char *s, uchar *out)
+{
+	__m128i c = _mm_loadu_si128((const __m128i *)s);
+	__m128i upper = b64_range(c, 'A', 'Z');
+	__m128i lower = b64_range(c, 'a', 'z');
+	__m128i digit = b64_range(c, '0', '9');
+	__m128i plus = _mm_cmpeq_epi8(c, _mm_set1_epi8('+'));
+	__m128i slash = _mm_cmpeq_epi8(c, _mm_set1_epi8('/'));
+	__m128i v, w;
+	uint32_t q[4];
+	int i;
+
+	if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(upper, lower),
+				_mm_or_si128(_mm_or_si128(digit, plus), slash))) != 0xffff)
+		return False;
+
+	/* The value of each character, by adding the offset of its range */
+	v = _mm_and_si128(upper, _mm_set1_epi8(-'A'));
+	v = _mm_or_si128(v, _mm_and_si128(lower, _mm_set1_epi8(26 - 'a')));
+	v = _mm_or_si128(v, _mm_and_si128(digit, _mm_set1_epi8(52 - '0')));
+	v = _mm_or_si128(v, _mm_and_si128(plus, _mm_set1_epi8(62 - '+')));
+	v = _mm_or_si128(v, _mm_and_si128(slash, _mm_set1_epi8(63 - '/')));
+	v = _mm_add_epi8(c, v);
+
+	/* Join pairs of 6 bits into 12, and pairs of those into 24 */
+	w = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(v, _mm_set1_epi16(0xff)), 6),
+			_mm_srli_epi16(v, 8));
+	w = _mm_or_si128(_mm_slli_epi32(_mm_and_si128(w, _mm_set1_epi32(0xffff)), 12),
+			_mm_srli_epi32(w, 16));
+
+	_mm_storeu_si128((__m128i *)q, w);
+	for (i = 0; i < 4; i++) {
+		out[3*i] = q[i] >> 16;
+		out[3*i+1] = q[i] >> 8;
+		out[3*i+2] = q[i];
+	}
+	return True;
+}
+#endif
+
+/*
+ * Find the first control character in s, which ends an OSC string,
+ * sixteen bytes at a time with SSE2. Returns end if there is none.
+ */
+static const char *osc_span(const char *s, const char *end)
+{
+#ifdef __SSE2__
+	__m128i c, ctl;
+
+	for (; end - s >= 16; s += 16) {
+		c = _mm_loadu_si128((const __m128i *)s);
+		/* Bytes up to 0x1f, and DEL */
+		ctl = _mm_or_si128(_mm_cmpeq_epi8(_mm_min_epu8(c, _mm_set1_epi8(0x1f)), c),
+				_mm_cmpeq_epi8(c, _mm_set1_epi8(0x7f)));
+		if (_mm_movemask_epi8(ctl))
+			break;
+	}
+#endif
+	while (s < end && !ISCONTROL(*s))
+		s++;
+	return s;
+}
+
+/*
+ * Take n bytes of the OSC string being parsed.
+ */
+static void osc_put(const char *s, size_t n)
+{
+	OSCEscape *osc = &term.osc;
+
+	while (n > 0 && osc->state == OSC_ARG) {
+		osc_arg(*s++);
+		n--;
+	}
+	if (n > 0 && osc->state == OSC_DATA)
+		osc_decode(s, n);
+}
+
+/*
+ * Take a character of the arguments of an OSC sequence, up to
+ * the data of OSC 52. Other sequences are ignored.
+ */
+static void osc_arg(char c)
+{
+	OSCEscape *osc = &term.osc;
+	char *sep;
+
+	if (osc->arglen == OSC_ARG_SIZ - 1) {
+		osc->state = OSC_IGNORE;
+		return;
+	}
+	if (c != ';') {
+		osc->arg[osc->arglen++] = c;
+		return;
+	}
+
+	osc->arg[osc->arglen] = '\0';
+	if (!(sep = strchr(osc->arg, ';'))) {
+		/* End of Ps */
+		if (strcmp(osc->arg, "52") != 0 || osc52_max <= 0)
+			osc->state = OSC_IGNORE;
+		osc->arg[osc->arglen++] = c;
+		return;
+	}
+
+	/* End of Pc: the data follows */
+	osc->state = OSC_DATA;
+	osc->len = 0;
+	osc->nquad = 0;
+	if (!osc->data) {
+		osc->size = BUFSIZ;
+		if (!(osc->data = malloc(osc->size)))
+			die("malloc failed: %s", strerror(errno));
+		mem_add(MEM_PARSER, osc->size);
+	}
+}
+
+/*
+ * Decode n characters of the base64 data of OSC 52, whole blocks
+ * of sixteen with SSE2. Characters outside of the alphabet, like
+ * the padding, are skipped. Data past osc52_max is refused.
+ */
+static void osc_decode(const char *s, size_t n)
+{
+	OSCEscape *osc = &term.osc;
+	const char *end = s + n;
+	size_t need;
+	int v;
+
+	/* A single ? asks for the selection instead */
+	if (osc->len == 0 && osc->nquad == 0 && *s == '?') {
+		osc->state = OSC_QUERY;
+		return;
+	}
+
+	/* Room for all of it, what is left over at the end, and a NUL */
+	need = osc->len + n / 4 * 3 + 8;
+	if (need > osc52_max + 8) {
+		debug(D_WARN, "OSC 52: selection longer than %d bytes", osc52_max);
+		osc->state = OSC_IGNORE;
+		return;
+	}
+	if (need > osc->size) {
+		need = MAX(need, 2 * osc->size);
+		mem_add(MEM_PARSER, need - osc->size);
+		osc->size = need;
+		if (!(osc->data = realloc(osc->data, osc->size)))
+			die("realloc failed: %s", strerror(errno));
+	}
+
+	while (s < end) {
+#ifdef __SSE2__
+		while (osc->nquad == 0 && end - s >= 16 &&
+				b64_decode16(s, (uchar *)osc->data + osc->len)) {
+			osc->len += 12;
+			s += 16;
+		}
+		if (s == end)
+			break;
+#endif
+		if ((v = b64_value(*s++)) < 0)
+			continue;
+		osc->quad = osc->quad << 6 | v;
+		if (++osc->nquad == 4) {
+			osc->data[osc->len++] = osc->quad >> 16;
+			osc->data[osc->len++] = osc->quad >> 8;
+			osc->data[osc->len++] = osc->quad;
+			osc->nquad = 0;
+		}
+	}
+}
+
+/*
+ * End the OSC sequence on control character c: BEL or ESC
+ * (the start of ST) complete it, CAN and SUB cancel it.
+ */
+static void osc_end(char c)
+{
+	OSCEscape *osc = &term.osc;
+	char *pc;
+
+	if (c == '\030' || c == '\032' || osc->state == OSC_IGNORE)
+		return;
+	if (osc->state == OSC_ARG)
+		osc_arg(';');
+	if (osc->state == OSC_ARG || !(pc = strchr(osc->arg, ';')))
+		return;
+	pc++;
+
+	if (osc->state == OSC_QUERY) {
+		osc52_query(pc, c);
+		return;
+	}
+
+	/* The characters left over by the last full quad */
+	if (osc->nquad == 2) {
+		osc->data[osc->len++] = osc->quad >> 4;
+	} else if (osc->nquad == 3) {
+		osc->data[osc->len++] = osc->quad >> 10;
+		osc->data[osc->len++] = osc->quad >> 2;
+	}
+	osc->data[osc->len] = '\0';
+	osc52_set(pc);
+}
+
+/*
+ * Hand the decoded data of OSC 52 to the selections named in pc:
+ * c for the clipboard, p or s for the primary selection, the
+ * clipboard if none. The data buffer becomes the first of them.
+ */
+static void osc52_set(const char *pc)
+{
+	OSCEscape *osc = &term.osc;
+	Bool clip = strchr(pc, 'c') || !*pc;
+	Bool primary = strchr(pc, 'p') || strchr(pc, 's');
+	char *text = osc->data;
+
+	mem_add(MEM_PARSER, -(long)osc->size);
+	osc->data = NULL;
+	osc->size = 0;
+
+	if (primary) {
+		sel_settext(&sel.primary, text);
+		if (sel_own(XA_PRIMARY, CurrentTime))
+			sel.sel_time = CurrentTime;
+		if (clip)
+			text = strdup(text);
+	}
+	if (clip) {
+		sel_settext(&sel.clipboard, text);
+		if (sel_own(clipboard_atom, CurrentTime))
+			sel.clip_time = CurrentTime;
+	}
+	if (!clip && !primary)
+		free(text);
+}
+
+/*
+ * Answer an OSC 52 query, ended by c, with the first selection in pc.
+ * Only a selection this window holds is given, if osc52_read allows.
+ * Otherwise the answer is empty.
+ */
+static void osc52_query(const char *pc, char c)
+{
+	Atom selection = (*pc == 'p' || *pc == 's') ? XA_PRIMARY : clipboard_atom;
+	char *text = (selection == XA_PRIMARY) ? sel.primary : sel.clipboard;
+	size_t len = 0, n = 0;
+	char *buf;
+
+	if (!osc52_read || !text ||
+			XGetSelectionOwner(xw.display, selection) != xw.win)
+		text = NULL;
+	if (text)
+		n = strlen(text);
+
+	if (!(buf = malloc(n / 3 * 4 + 4 + OSC_ARG_SIZ + 8)))
+		die("malloc failed: %s", strerror(errno));
+	len = sprintf(buf, "\033]52;%c;", (selection == XA_PRIMARY) ? 'p' : 'c');
+	len += b64_encode(text, n, buf + len);
+	len += sprintf(buf + len, (c == '\a') ? "\a" : "\033\\");
+	tty_write(buf, len);
+	free(buf);
+}
+
+/*
+ * Value of a base64 character, or -1 if it is not one.
+ */
+static int b64_value(uchar c)
+{
+	if (BETWEEN(c, 'A', 'Z'))
+		return c - 'A';
+	if (BETWEEN(c, 'a', 'z'))
+		return c - 'a' + 26;
+	if (BETWEEN(c, '0', '9'))
+		return c - '0' + 52;
+	if (c == '+')
+		return 62;
+	if (c == '/')
+		return 63;
+	return -1;
+}
+
+/*
+ * Encode n bytes of s as base64 into out, which has
+ * room for (n + 2) / 3 * 4 bytes. Returns the length.
+ */
+static size_t b64_encode(const char *s, size_t n, char *out)
+{
+	static const char alphabet[] =
+		"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+	const uchar *u = (const uchar *)s;
+	size_t i, len = 0;
+	uint32_t v;
+
+	for (i = 0; i < n; i += 3) {
+		v = u[i] << 16 | (i + 1 < n ? u[i+1] << 8 : 0) | (i + 2 < n ? u[i+2] : 0);
+		out[len++] = alphabet[v >> 18 & 0x3f];
+		out[len++] = alphabet[v >> 12 & 0x3f];
+		out[len++] = (i + 1 < n) ? alphabet[v >> 6 & 0x3f] : '=';
+		out[len++] = (i + 2 < n) ? alphabet[v & 0x3f] : '=';
+	}
+	return len;
+}
+
+/*
+ * Move the cursor down a line, scrolling at the bottom of the scroll
+ * region. Only lines scrolled off a whole screen go into history.
+ */
+static void term_newline(void)
+{
+	if (term.cursor.y == term.bot) {
+		if (term.top == 0 && term.bot == term.rows-1)
+			term_histpush(0);
+		term_scroll(term.top, term.bot, 1);
+	} else {
+		term_moveto(term.cursor.x, term.cursor.y + 1);
+	}
+}
+
+/*
+ * Scroll rows top to bottom up by n lines, or down for negative n.
+ * The lines are rotated, not copied, and the rows coming in cleared.
+ * Their dirtiness and matches move along, and the drawing buffer
+ * follows at the next frame, so only the new rows are drawn.
+ */
+static void term_scroll(int top, int bot, int n)
+{
+	int height = bot - top + 1, in;
+	uint64_t start = trace_now();
+
+	LIMIT(n, -height, height);
+	if (n == 0)
+		return;
+
+	array_rotate(term.line + top, sizeof(*term.line), height, n);
+	array_rotate(term.style + top, sizeof(*term.style), height, n);
+	array_rotate(term.dirty + top, sizeof(*term.dirty), height, n);
+	array_rotate(term.lm + top, sizeof(*term.lm), height, n);
+
+	in = (n > 0) ? bot - n + 1 : top;
+	term_clear(0, in, term.cols-1, in + abs(n) - 1);
+
+	/* A view scrolled back into history is drawn whole anyway */
+	if (!term.scroll)
+		xwindow_scroll(top, bot, -n);
+	trace_span("scroll", start, "lines", n);
+}
+
+/*
+ * Rotate an array of len elements of the given size
+ * left by n elements, or right for negative n.
+ */
+static void array_rotate(void *a, size_t size, int len, int n)
+{
+	char *p = a;
+	int k = (n > 0) ? n : len + n;
+
+	/* Rotating by 0 or len moves nothing */
+	if (k > 0 && k < len) {
+		char tmp[k * size];
+
+		memcpy(tmp, p, k * size);
+		memmove(p, p + k * size, (len - k) * size);
+		memcpy(p + (len - k) * size, tmp, k * size);
+	}
+}
+
+/*
+ * Blank both halves of a wide character that a shift of
+ * the cells of row y at column x would split.
+ */
+static void term_splitwide(int x, int y)
+{
+	Rune *line = term.line[y];
+
+	if (x > 0 && x < term.cols && line[x] == WIDE_TAIL) {
+		cell_set(&line[x-1], ' ');
+		line[x] = ' ';
+	}
+}
+
+/*
+ * Insert n blank characters at the cursor (ICH). The rest
+ * of the line moves right, and what passes the edge is lost.
+ */
+static void term_insertblank(int n)
+{
+	int x = term.cursor.x, y = term.cursor.y;
+	Rune *line = term.line[y];
+	ushort *style = term.style[y];
+	int i;
+
+	LIMIT(n, 1, term.cols - x);
+	term_splitwide(x, y);
+	term_splitwide(term.cols - n, y);
+
+	cell_release(line + term.cols - n, n);
+	style_release(style + term.cols - n, n);
+	memmove(line + x + n, line + x, (term.cols - x - n) * sizeof(*line));
+	memmove(style + x + n, style + x, (term.cols - x - n) * sizeof(*style));
+	memset(style + x, 0, n * sizeof(*style));
+	for (i = x; i < x + n; i++)
+		line[i] = ' ';
+
+	term_clear(x, y, x + n - 1, y);
+}
+
+/*
+ * Delete n characters at the cursor (DCH). The rest of the
+ * line moves left, and blanks come in at the edge.
+ */
+static void term_deletechar(int n)
+{
+	int x = term.cursor.x, y = term.cursor.y;
+	Rune *line = term.line[y];
+	ushort *style = term.style[y];
+	int i;
+
+	LIMIT(n, 1, term.cols - x);
+	term_splitwide(x, y);
+	term_splitwide(x + n, y);
+
+	cell_release(line + x, n);
+	style_release(style + x, n);
+	memmove(line + x, line + x + n, (term.cols - x - n) * sizeof(*line));
+	memmove(style + x, style + x + n, (term.cols - x - n) * sizeof(*style));
+	memset(style + term.cols - n, 0, n * sizeof(*style));
+	for (i = term.cols - n; i < term.cols; i++)
+		line[i] = ' ';
+
+	term_clear(term.cols - n, y, term.cols - 1, y);
+}
+
+/*
+ * Erase n characters from the cursor on (ECH), in place.
+ */
+static void term_erasechar(int n)
+{
+	int x = term.cursor.x, y = term.cursor.y;
+
+	LIMIT(n, 1, term.cols - x);
+	term_splitwide(x, y);
+	term_splitwide(x + n, y);
+	term_clear(x, y, x + n - 1, y);
+}
+
+/*
+ * Move a row into history, and replace it with a blank line. The
+ * oldest line is recycled once history is full.
+ */
+static void term_histpush(int row)
+{
+	HistLine *h;
+	Rune *line = NULL;
+	ushort *style = NULL;
+	int x;
+
+	if (history_size > 0) {
+		term.histtop = (term.histtop + 1) % history_size;
+		h = &term.hist[term.histtop];
+		if (term.histlen == history_size) {
+			if (history_spill && !term.nospill)
+				spill_push(h->line, h->style, h->len);
+			cell_release(h->line, h->len);
+			style_release(h->style, h->len);
+			mem_add(MEM_HISTORY, -h->len * CELL_SIZE);
+			line = h->line;
+			style = h->style;
+		} else {
+			term.histlen++;
+		}
+		*h = (HistLine){ .line = term.line[row], .style = term.style[row],
+			.len = term.cols };
+		mem_add(MEM_HISTORY, term.cols * CELL_SIZE);
+	} else {
+		if (history_spill && !term.nospill)
+			spill_push(term.line[row], term.style[row], term.cols);
+		cell_release(term.line[row], term.cols);
+		style_release(term.style[row], term.cols);
+		line = term.line[row];
+		style = term.style[row];
+	}
+
+	term.histno++;
+	/* A view scrolled back keeps showing the same lines */
+	if (term.scroll)
+		term.scroll = MIN(term.scroll + 1, term_histcount());
+
+	term.line[row] = realloc(line, term.cols * sizeof(*line));
+	term.style[row] = realloc(style, term.cols * sizeof(*style));
+	for (x = 0; x < term.cols; x++) {
+		term.line[row][x] = ' ';
+		term.style[row][x] = 0;
+	}
+}
+
+/*
+ * Number of lines the view can scroll back: history, and the lines
+ * spilled from it.
+ */
+static long term_histcount(void)
+{
+	return term.histlen + (term.spill ? term.spill->n : 0);
+}
+
+/*
+ * Cells of line n, counting lines ever pushed to history: history
+ * lines come before term.histno, screen rows from it on. Returns the
+ * number of cells, or -1 if the line is gone or not there yet.
+ */
+static int term_line(long n, Rune **line, ushort **style)
+{
+	HistLine *h;
+	long back = term.histno - n;
+
+	if (back <= 0) {
+		if (-back >= term.rows)
+			return -1;
+		*line = term.line[-back];
+		*style = term.style[-back];
+		return term.cols;
+	}
+	if (back > term_histcount())
+		return -1;
+	if (back > term.histlen)
+		return spill_line(term.spill->n - (back - term.histlen), line, style);
+
+	h = &term.hist[(term.histtop - back + 1 + history_size) % history_size];
+	*line = h->line;
+	*style = h->style;
+	return h->len;
+}
+
+/*
+ * Append a line dropped from history to the spill files, opening
+ * them on first use. They are unlinked, so they go with the process.
+ */
+static void spill_push(Rune *line, ushort *style, int len)
+{
+	Spill *sp = term.spill;
+	SpillRow *row;
+	SpillRun *run;
+	const Rune *rs;
+	uint32_t *r;
+	uint64_t off;
+	size_t size;
+	int x, i, n, fd[2];
+	char path[PATH_MAX], *dir;
+
+	if (!sp) {
+		dir = getenv("TMPDIR") ? getenv("TMPDIR") : "/tmp";
+		for (i = 0; i < 2; i++) {
+#ifdef O_TMPFILE
+			if ((fd[i] = open(dir, O_TMPFILE | O_RDWR | O_EXCL | O_CLOEXEC, 0600)) >= 0)
+				continue;
+#endif
+			/* No O_TMPFILE support: unlink a temporary file right away */
+			snprintf(path, sizeof(path), "%s/term-XXXXXX", dir);
+			if ((fd[i] = mkstemp(path)) < 0)
+				break;
+			unlink(path);
+			fcntl(fd[i], F_SETFD, FD_CLOEXEC);
+		}
+		if (i < 2) {
+			debug(D_WARN, "history spill file in \"%s\": %s", dir, strerror(errno));
+			if (i > 0)
+				close(fd[0]);
+			term.nospill = True;
+			return;
+		}
+		if (!(sp = term.spill = calloc(1, sizeof(*sp))))
+			die("calloc failed: %s", strerror(errno));
+		mem_add(MEM_SPILL, sizeof(*sp));
+		sp->data.fd = fd[0];
+		sp->index.fd = fd[1];
+		for (i = 0; i < SPILL_CACHE; i++)
+			sp->rowno[i] = -1;
+	}
+
+	/* Worst case: a run and CLUSTER_MAX code points per cell */
+	size = sizeof(*row) + len * (sizeof(*run) + CLUSTER_MAX * sizeof(*r));
+	if (size > sp->bufsize) {
+		if (!(sp->buf = realloc(sp->buf, size)))
+			die("realloc failed: %s", strerror(errno));
+		mem_add(MEM_SPILL, size - sp->bufsize);
+		sp->bufsize = size;
+	}
+
+	row = (SpillRow *)sp->buf;
+	run = (SpillRun *)(row + 1);
+	*row = (SpillRow){ .len = len };
+	for (x = 0; x < len; x++) {
+		if (x == 0 || style[x] != style[x-1]) {
+			run[row->nruns++] = (SpillRun){ .n = 0, .style = term.styles[style[x]].style };
+		}
+		run[row->nruns-1].n++;
+	}
+	r = (uint32_t *)(run + row->nruns);
+	for (x = 0; x < len; x++) {
+		rs = cell_runes(&line[x], &n);
+		for (i = 0; i < n; i++)
+			r[row->nrunes++] = i ? rs[i] | CLUSTER_BIT : rs[i];
+	}
+
+	off = sp->data.size;
+	if (spill_write(&sp->data, sp->buf, (uchar *)(r + row->nrunes) - sp->buf) < 0 ||
+			spill_write(&sp->index, &off, sizeof(off)) < 0) {
+		spill_stop();
+		return;
+	}
+	sp->n++;
+}
+
+/*
+ * Get spilled row n, decoding it unless it still is. The cells
+ * are valid until SPILL_CACHE other rows are decoded.
+ */
+static int spill_line(long n, Rune **line, ushort **style)
+{
+	Spill *sp = term.spill;
+	HistLine *h = &sp->rows[n % SPILL_CACHE];
+	const SpillRow *row;
+	const SpillRun *run;
+	const uint32_t *r;
+	const uint64_t *off;
+	ushort idx;
+	int x, i, k;
+
+	if (sp->rowno[n % SPILL_CACHE] != n) {
+		if (!(off = spill_map(&sp->index, n * sizeof(*off), sizeof(*off))) ||
+				!(row = spill_map(&sp->data, *off, sizeof(*row))) ||
+				!(row = spill_map(&sp->data, *off, sizeof(*row) +
+					row->nruns * sizeof(*run) + row->nrunes * sizeof(*r)))) {
+			spill_stop();
+			return -1;
+		}
+		run = (const SpillRun *)(row + 1);
+		r = (const uint32_t *)(run + row->nruns);
+
+		cell_release(h->line, h->len);
+		style_release(h->style, h->len);
+		mem_add(MEM_SPILL, ((long)row->len + 1 - (h->line ? h->len + 1 : 0)) * CELL_SIZE);
+		h->line = realloc(h->line, (row->len + 1) * sizeof(*h->line));
+		h->style = realloc(h->style, (row->len + 1) * sizeof(*h->style));
+		h->len = row->len;
+
+		for (x = 0, i = 0; i < row->nruns; i++) {
+			idx = style_intern((Style *)&run[i].style);
+			for (k = 0; k < run[i].n; k++)
+				h->style[x++] = idx;
+			if (idx)
+				term.styles[idx].refs += run[i].n - 1;
+		}
+		for (x = -1, i = 0; i < row->nrunes; i++) {
+			if (r[i] & CLUSTER_BIT)
+				h->line[x] = cluster_add(h->line[x], r[i] & ~CLUSTER_BIT);
+			else
+				h->line[++x] = r[i];
+		}
+		sp->rowno[n % SPILL_CACHE] = n;
+	}
+
+	*line = h->line;
+	*style = h->style;
+	return h->len;
+}
+
+/*
+ * Get len bytes at off of a spill file, mapping more of it
+ * if they lie past the mapping. Returns NULL on failure.
+ */
+static const void *spill_map(SpillFile *f, uint64_t off, size_t len)
+{
+	uchar *map;
+	size_t maplen;
+
+	if (off + len > f->maplen) {
+		if (f->map)
+			munmap(f->map, f->maplen);
+		mem_add(MEM_SPILLMAP, -(long)f->maplen);
+		f->map = NULL;
+		f->maplen = 0;
+
+		maplen = (f->size + SPILL_MAP_STEP - 1) / SPILL_MAP_STEP * SPILL_MAP_STEP;
+		map = mmap(NULL, maplen, PROT_READ, MAP_SHARED, f->fd, 0);
+		if (map == MAP_FAILED) {
+			debug(D_WARN, "mmap of history spill failed: %s", strerror(errno));
+			return NULL;
+		}
+		f->map = map;
+		f->maplen = maplen;
+		mem_add(MEM_SPILLMAP, f->maplen);
+	}
+	return f->map + off;
+}
+
+/*
+ * Append to a spill file. Returns -1 on failure.
+ */
+static int spill_write(SpillFile *f, const void *buf, size_t len)
+{
+	if (swrite(f->fd, buf, len) < 0) {
+		debug(D_WARN, "write to history spill failed: %s", strerror(errno));
+		return -1;
+	}
+	f->size += len;
+	return 0;
+}
+
+/*
+ * Give up spilling after a spill file failed, say when its file
+ * system is full. The spilled lines are lost, and lines pushed out
+ * of this window's history are dropped from then on, as without
+ * history_spill.
+ */
+static void spill_stop(void)
+{
+	Spill *sp = term.spill;
+	int i;
+
+	for (i = 0; i < SPILL_CACHE; i++) {
+		cell_release(sp->rows[i].line, sp->rows[i].len);
+		style_release(sp->rows[i].style, sp->rows[i].len);
+	}
+	spill_free();
+	term.nospill = True;
+
+	if (term.scroll > term.histlen) {
+		term.scroll = term.histlen;
+		term_fulldirty();
+	}
+}
+
+/*
+ * Close the spill files and free the spilled rows.
+ */
+static void spill_free(void)
+{
+	Spill *sp = term.spill;
+	int i;
+
+	if (!sp)
+		return;
+
+	if (sp->data.map)
+		munmap(sp->data.map, sp->data.maplen);
+	if (sp->index.map)
+		munmap(sp->index.map, sp->index.maplen);
+	close(sp->data.fd);
+	close(sp->index.fd);
+	mem_add(MEM_SPILLMAP, -(long)(sp->data.maplen + sp->index.maplen));
+	for (i = 0; i < SPILL_CACHE; i++) {
+		if (sp->rows[i].line)
+			mem_add(MEM_SPILL, -(sp->rows[i].len + 1) * CELL_SIZE);
+		free(sp->rows[i].line);
+		free(sp->rows[i].style);
+	}
+	mem_add(MEM_SPILL, -(long)(sp->bufsize + sizeof(*sp)));
+	free(sp->buf);
+	free(sp);
+	term.spill = NULL;
+}
+
+/*
+ * Memory of a screen of rows lines of cols cells, with their state.
+ */
+static long term_screensize(int cols, int rows)
+{
+	return rows * (cols * CELL_SIZE + (long)(sizeof(*term.line) +
+			sizeof(*term.style) + sizeof(*term.dirty) + sizeof(*term.drawn) +
+			sizeof(*term.lm)));
+}
+
+static void term_moveto(int x, int y)
+{
+	term.wrapnext = False;
+	term.cursor.x = LIMIT(x, 0, term.cols-1);
+	term.cursor.y = LIMIT(y, 0, term.rows-1);
+}
+
+/*
+ * Resize terminal (internal).
+ */
+static void term_resize(int cols, int rows)
+{
+	int i, x;
+	int mincols = MIN(term.cols, cols);
+	int minrows = MIN(term.rows, rows);
+
+	mem_add(MEM_SCREEN, term_screensize(cols, rows) -
+			term_screensize(term.cols, term.rows));
+
+	/* Rows above the cursor that no longer fit go into history */
+	for (i = 0; i <= term.cursor.y - rows; i++) {
+		term_histpush(i);
+		free(term.line[i]);
+		free(term.style[i]);
+		mem_add(MEM_HINTS, -term.lm[i].size * (long)sizeof(Match));
+		free(term.lm[i].match);
+	}
+	if (i > 0) {
+		memmove(term.line, term.line + i, rows * sizeof(*term.line));
+		memmove(term.style, term.style + i, rows * sizeof(*term.style));
+		memmove(term.lm, term.lm + i, rows * sizeof(*term.lm));
+	}
+	for (i += rows; i < term.rows; i++) {
+		cell_release(term.line[i], term.cols);
+		style_release(term.style[i], term.cols);
+		free(term.line[i]);
+		free(term.style[i]);
+		mem_add(MEM_HINTS, -term.lm[i].size * (long)sizeof(Match));
+		free(term.lm[i].match);
+	}
+
+	/* Reallocate height dependent elements */
+	term.line = realloc(term.line, rows * sizeof(*term.line));
+	term.style = realloc(term.style, rows * sizeof(*term.style));
+	term.dirty = realloc(term.dirty, rows * sizeof(*term.dirty));
+	term.drawn = realloc(term.drawn, rows * sizeof(*term.drawn));
+	memset(term.drawn, 0, rows * sizeof(*term.drawn));
+	term.lm = realloc(term.lm, rows * sizeof(*term.lm));
+	for (i = minrows; i < rows; i++)
+		term.lm[i] = (LineMatch){ .match = NULL, .n = 0, .size = 0 };
+
+	/* Resize rows, new cells are blank until cleared below */
+	for (i = 0; i < minrows; i++) {
+		if (cols < term.cols) {
+			cell_release(term.line[i] + cols, term.cols - cols);
+			style_release(term.style[i] + cols, term.cols - cols);
+		}
+		term.line[i] = realloc(term.line[i], cols * sizeof(*term.line[i]));
+		term.style[i] = realloc(term.style[i], cols * sizeof(*term.style[i]));
+		for (x = term.cols; x < cols; x++) {
+			term.line[i][x] = ' ';
+			term.style[i][x] = 0;
+		}
+	}
+	/* Allocate new rows (if any) */
+	for (; i < rows; i++) {
+		term.line[i] = malloc(cols * sizeof(*term.line[i]));
+		term.style[i] = malloc(cols * sizeof(*term.style[i]));
+		for (x = 0; x < cols; x++) {
+			term.line[i][x] = ' ';
+			term.style[i][x] = 0;
+		}
+	}
+
+	/* Update terminal size */
+	term.cols = cols;
+	term.rows = rows;
+	term.top = 0;
+	term.bot = rows - 1;
+
+	/* Matches may run past the new width: rescan everything */
+	for (i = 0; i < rows; i++)
+		term.lm[i].dirty = True;
+	term_moveto(term.cursor.x, term.cursor.y);
+
+	/* Clear new cols */
+	if (cols > mincols && rows > 0)
+		term_clear(mincols, 0, cols - 1, minrows - 1);
+	/* Clear new rows (and new cols/rows overlap) */
+	if (rows > minrows && cols > 0)
+		term_clear(0, minrows, cols - 1, rows - 1);
+}
+
+/*
+ * Clear a region of the internal terminal.
+ */
+static void term_clear(int x1, int y1, int x2, int y2)
+{
+	/* Erased characters keep the current background */
+	Style erased = { .fg = term.pen.fg, .bg = term.pen.bg, .attr = 0 };
+	ushort idx = style_intern(&erased);
+	int x, y;
+
+	/* Contrain coords */
+	LIMIT(x1, 0, term.cols-1);
+	LIMIT(y1, 0, term.rows-1);
+	LIMIT(x2, 0, term.cols-1);
+	LIMIT(y2, 0, term.rows-1);
+
+	for (y = y1; y <= y2; y++) {
+		term.dirty[y] = True;
+		term.lm[y].dirty = True;
+		for (x = x1; x <= x2; x++) {
+			cell_set(&term.line[y][x], ' ');
+			style_set(&term.style[y][x], idx);
+		}
+	}
+	style_release(&idx, 1);
+}
+
+/*
+ * Set term rows in range [top,bottom] as dirty.
+ */
+static void term_setdirty(int top, int bottom)
+{
+	int i;
+
+	LIMIT(top, 0, term.rows-1);
+	LIMIT(bottom, 0, term.rows-1);
+
+	for (i = top; i <= bottom; i++)
+		term.dirty[i] = True;
+}
+
+/*
+ * Set all term rows as dirty.
+ */
+static void term_fulldirty(void)
+{
+	term_setdirty(0, term.rows-1);
+}
+
+/*
+ * Initialize Selection. Must be called after
+ * x_init() in order to set target atom.
+ */
+static void sel_init(void)
+{
+	sel.primary = NULL;
+	sel.clipboard = NULL;
+	sel.target = utf8_atom;
+}
+
+static void sel_convert(Atom selection, Time time)
+{
+	DEBUG("Converting selection");
+
+	XConvertSelection(xw.display, selection, sel.target,
+			sel.target, xw.win, time);
+}
+
+static Bool sel_own(Atom selection, Time time)
+{
+	XSetSelectionOwner(xw.display, selection, xw.win, time);
+
+	if (XGetSelectionOwner(xw.display, selection) != xw.win) 
+		return False;
 
 	XSetErrorHandler(x_error_handler); // FIXME: is this necessary?
 	return True;
 }
 
-static void sel_copy(Time time)
+/*
+ * Replace the text of the selection at p with text, which it takes over.
+ */
+static void sel_settext(char **p, char *text)
+{
+	if (*p)
+		mem_add(MEM_SELECTION, -(long)(strlen(*p) + 1));
+	free(*p);
+	if ((*p = text))
+		mem_add(MEM_SELECTION, strlen(text) + 1);
+}
+
+static void sel_copy(Time time)
+{
+	/* TODO: get text selection for primary */
+	sel_settext(&sel.primary, strdup("text"));
+
+	if (sel_own(XA_PRIMARY, time))
+		sel.sel_time = time;
+}
+
+/*
+ * Compile the hint patterns.
+ */
+static void hint_init(void)
+{
+	char err[BUFSIZ/4];
+	int i, r;
+
+	hint_regex = calloc(LEN(hint_patterns), sizeof(*hint_regex));
+
+	for (i = 0; i < LEN(hint_patterns); i++) {
+		if ((r = regcomp(&hint_regex[i], hint_patterns[i], REG_EXTENDED))) {
+			regerror(r, &hint_regex[i], err, sizeof(err));
+			die("invalid hint pattern \"%s\": %s", hint_patterns[i], err);
+		}
+	}
+}
+
+/*
+ * Add a match to a line's matches, keeping them ordered by column.
+ * Matches overlapping an existing one are dropped, so earlier
+ * patterns take precedence over later ones.
+ */
+static void hint_add(LineMatch *lm, int x, int len)
+{
+	int i;
+
+	for (i = 0; i < lm->n && lm->match[i].x < x; i++)
+		;
+	if (i > 0 && lm->match[i-1].x + lm->match[i-1].len > x)
+		return;
+	if (i < lm->n && x + len > lm->match[i].x)
+		return;
+
+	if (lm->n == lm->size) {
+		mem_add(MEM_HINTS, (lm->size ? lm->size : 4) * (long)sizeof(*lm->match));
+		lm->size = lm->size ? 2 * lm->size : 4;
+		lm->match = realloc(lm->match, lm->size * sizeof(*lm->match));
+	}
+	memmove(&lm->match[i+1], &lm->match[i], (lm->n - i) * sizeof(*lm->match));
+	lm->match[i].x = x;
+	lm->match[i].len = len;
+	lm->n++;
+}
+
+/*
+ * Rebuild the matches of a single line.
+ */
+static void hint_scan(int row)
+{
+	LineMatch *lm = &term.lm[row];
+	char buf[term.cols * UTF_SIZ * CLUSTER_MAX + 1];
+	int col[term.cols * UTF_SIZ * CLUSTER_MAX + 1];	/* column of every byte */
+	regmatch_t rm;
+	int i, n, x, off, len = 0;
+
+	/* Patterns are matched against the line as UTF-8 */
+	for (x = 0; x < term.cols; x++) {
+		n = utf8_string(&term.line[row][x], 1, buf + len);
+		for (i = 0; i < n; i++)
+			col[len++] = x;
+	}
+	buf[len] = '\0';
+	col[len] = term.cols;
+
+	lm->n = 0;
+	lm->dirty = False;
+
+	for (i = 0; i < LEN(hint_patterns); i++) {
+		for (off = 0; off < len; off += rm.rm_eo) {
+			if (regexec(&hint_regex[i], buf + off, 1, &rm,
+						off ? REG_NOTBOL : 0) != 0)
+				break;
+			if (rm.rm_eo == rm.rm_so) {
+				/* Step over empty matches */
+				rm.rm_eo++;
+				continue;
+			}
+			hint_add(lm, col[off + rm.rm_so],
+					col[off + rm.rm_eo] - col[off + rm.rm_so]);
+		}
+	}
+}
+
+/*
+ * Rescan the lines that changed since they were last scanned.
+ * Called once the parser has consumed a read from the tty, so
+ * that hint mode never needs to look at the whole screen.
+ */
+static void hint_update(void)
+{
+	uint64_t start = trace_now();
+	int row, n = 0;
+
+	for (row = 0; row < term.rows; row++) {
+		if (term.lm[row].dirty) {
+			hint_scan(row);
+			n++;
+		}
+	}
+	trace_span("hint_update", start, "rows", n);
+}
+
+/*
+ * Enter hint mode, labelling every match on the screen.
+ */
+static void hint_start(Bool pipe, Time time)
+{
+	int row, cap, nchars = sstrlen(hint_chars);
+
+	hint_update();
+
+	hint.n = 0;
+	for (row = 0; row < term.rows; row++)
+		hint.n += term.lm[row].n;
+	if (hint.n == 0 || nchars < 2)
+		return;
+
+	/* All labels have the same length, so none is a prefix of another */
+	for (hint.labellen = 1, cap = nchars; cap < hint.n; cap *= nchars)
+		hint.labellen++;
+	if (hint.labellen > sizeof(hint.input))
+		return;
+
+	/* Labels are over the screen lines */
+	view_scroll(-term.scroll);
+
+	hint.active = True;
+	hint.pipe = pipe;
+	hint.ninput = 0;
+	term_fulldirty();
+}
+
+/*
+ * Leave hint mode. The fingerprints of the rows don't cover the
+ * labels drawn over them, so every row is repainted.
+ */
+static void hint_stop(void)
+{
+	hint.active = False;
+	memset(term.drawn, 0, term.rows * sizeof(*term.drawn));
+	term_fulldirty();
+}
+
+/*
+ * Handle a key press while in hint mode.
+ */
+static void hint_keypress(KeySym keysym, char *buf, int len, Time time)
+{
+	int i, n, nchars = sstrlen(hint_chars);
+	char *p;
+
+	if (keysym == XK_Escape) {
+		hint_stop();
+	} else if (keysym == XK_BackSpace) {
+		if (hint.ninput > 0)
+			hint.ninput--;
+	} else if (len == 1 && (p = strchr(hint_chars, buf[0])) && *p) {
+		hint.input[hint.ninput++] = *p;
+
+		if (hint.ninput == hint.labellen) {
+			for (i = 0, n = 0; i < hint.labellen; i++)
+				n = n * nchars + (strchr(hint_chars, hint.input[i]) - hint_chars);
+			hint_stop();
+			if (n < hint.n)
+				hint_choose(n, time);
+		}
+	}
+
+	term_fulldirty();
+}
+
+/*
+ * Draw the labels of the matches whose label starts
+ * with what has been typed so far.
+ */
+static void hint_draw(void)
+{
+	char label[sizeof(hint.input)];
+	Rune rlabel[sizeof(hint.input)];
+	Style style = { .fg = color_bg, .bg = hint_color, .attr = 0 };
+	Match *m;
+	int i, row, n = 0;
+
+	for (row = 0; row < term.rows; row++) {
+		for (m = term.lm[row].match; m < term.lm[row].match + term.lm[row].n; m++) {
+			hint_label(n++, label);
+			if (strncmp(label, hint.input, hint.ninput) != 0)
+				continue;
+			for (i = 0; i < hint.labellen; i++)
+				rlabel[i] = (uchar)label[i];
+			draw_run(m->x, row, rlabel, hint.labellen, &style);
+		}
+	}
+}
+
+/*
+ * Get the label of the nth match.
+ */
+static void hint_label(int n, char *label)
+{
+	int i, nchars = sstrlen(hint_chars);
+
+	for (i = hint.labellen - 1; i >= 0; i--) {
+		label[i] = hint_chars[n % nchars];
+		n /= nchars;
+	}
+}
+
+/*
+ * Copy the text of the nth match to the primary selection and
+ * clipboard, or pipe it to hint_cmd.
+ */
+static void hint_choose(int n, Time time)
+{
+	LineMatch *lm;
+	Match *m;
+	int row, len;
+
+	for (row = 0, lm = term.lm; row < term.rows; row++, lm++) {
+		if (n < lm->n)
+			break;
+		n -= lm->n;
+	}
+	if (row == term.rows)
+		return;
+	m = &lm->match[n];
+
+	char buf[m->len * UTF_SIZ * CLUSTER_MAX];
+
+	len = utf8_string(term.line[row] + m->x, m->len, buf);
+	if (hint.pipe) {
+		hint_pipe(buf, len);
+		return;
+	}
+
+	sel_settext(&sel.primary, strndup(buf, len));
+	if (sel_own(XA_PRIMARY, time))
+		sel.sel_time = time;
+
+	sel_settext(&sel.clipboard, strdup(sel.primary));
+	if (sel_own(clipboard_atom, time))
+		sel.clip_time = time;
+}
+
+/*
+ * Run hint_cmd with the given text on its standard input.
+ */
+static void hint_pipe(const char *s, size_t len)
+{
+	int fd;
+
+	if ((fd = spawn_pipe(hint_cmd)) < 0)
+		return;
+	if (swrite(fd, s, len) < 0)
+		debug(D_WARN, "write to hint command failed: %s", strerror(errno));
+	close(fd);
+}
+
+/*
+ * Run cmd in the background. Returns the write end of
+ * a pipe to its standard input, or -1 on failure.
+ */
+static int spawn_pipe(char **cmd)
+{
+	sigset_t mask;
+	int fd[2];
+
+	if (pipe(fd) < 0) {
+		debug(D_WARN, "pipe failed: %s", strerror(errno));
+		return -1;
+	}
+
+	switch (fork()) {
+	case -1:
+		debug(D_WARN, "fork failed: %s", strerror(errno));
+		close(fd[0]);
+		close(fd[1]);
+		return -1;
+	case 0:		/* CHILD */
+		setsid();
+		dup2(fd[0], STDIN_FILENO);
+		close(fd[0]);
+		close(fd[1]);
+		signal(SIGPIPE, SIG_DFL);
+		sigemptyset(&mask);
+		sigprocmask(SIG_SETMASK, &mask, NULL);
+		execvp(cmd[0], cmd);
+		_exit(EXIT_FAILURE);
+	}
+
+	close(fd[0]);
+	fcntl(fd[1], F_SETFD, FD_CLOEXEC);
+	return fd[1];
+}
+
+/*
+ * Export the history and screen, as plain text or with SGR sequences,
+ * to the standard input of export_cmd or to export_file. The lines
+ * are written as the reader takes them, from main_loop().
+ */
+static void export_start(Bool sgr)
+{
+	Export *ex;
+	int fd;
+
+	if (term.export) {
+		debug(D_WARN, "export already in progress");
+		return;
+	}
+
+	if (export_file) {
+		if ((fd = open(export_file, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600)) < 0) {
+			debug(D_WARN, "open %s failed: %s", export_file, strerror(errno));
+			return;
+		}
+	} else if ((fd = spawn_pipe(export_cmd)) < 0) {
+		return;
+	}
+	fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+
+	if (!(ex = term.export = calloc(1, sizeof(*ex))))
+		die("calloc failed: %s", strerror(errno));
+	mem_add(MEM_PARSER, sizeof(*ex));
+	ex->fd = fd;
+	ex->sgr = sgr;
+	ex->next = term.histno - term_histcount();
+	ex->end = term.histno + term.rows;
+	/* Regular files can't be polled, and are always writable */
+	ex->polled = loop_watch_write(fd, ex);
+}
+
+/*
+ * Encode lines of the export into its buffer, until
+ * about EXPORT_BUF bytes or the last line.
+ */
+static void export_encode(void)
+{
+	Export *ex = term.export;
+	Rune *line;
+	ushort *style;
+	const Style *st;
+	size_t need;
+	int x, len;
+	ushort cur;
+
+	ex->len = ex->off = 0;
+	while (ex->len < EXPORT_BUF && ex->next < ex->end) {
+		/* Lines lost from history while exporting are skipped */
+		ex->next = MAX(ex->next, term.histno - term_histcount());
+		if ((len = term_line(ex->next++, &line, &style)) < 0)
+			continue;
+
+		/* Trailing blanks are left out */
+		while (len > 0 && line[len-1] == ' ' && (!ex->sgr || style[len-1] == 0))
+			len--;
+
+		need = ex->len + len * (UTF_SIZ * CLUSTER_MAX + SGR_SIZ) + SGR_SIZ + 1;
+		if (need > ex->size) {
+			need = MAX(need, EXPORT_BUF + EXPORT_BUF / 2);
+			mem_add(MEM_PARSER, need - ex->size);
+			ex->size = need;
+			if (!(ex->buf = realloc(ex->buf, ex->size)))
+				die("realloc failed: %s", strerror(errno));
+		}
+
+		for (x = 0, cur = 0; x < len; x++) {
+			if (ex->sgr && style[x] != cur) {
+				cur = style[x];
+				st = &term.styles[cur].style;
+				ex->len += sgr_string(st, ex->buf + ex->len);
+			}
+			ex->len += utf8_string(&line[x], 1, ex->buf + ex->len);
+		}
+		/* Each line starts with the default style */
+		if (cur)
+			ex->len += sgr_string(&term.styles[0].style, ex->buf + ex->len);
+		ex->buf[ex->len++] = '\n';
+	}
+}
+
+/*
+ * Write as much of the export as the reader takes, up to
+ * EXPORT_BUDGET bytes, and end it after the last line.
+ */
+static void export_write(void)
+{
+	Export *ex = term.export;
+	size_t budget = EXPORT_BUDGET;
+	ssize_t n;
+
+	while (budget > 0) {
+		if (ex->off == ex->len) {
+			if (ex->next >= ex->end) {
+				export_stop();
+				return;
+			}
+			export_encode();
+			continue;
+		}
+		if ((n = write(ex->fd, ex->buf + ex->off, ex->len - ex->off)) < 0) {
+			if (errno == EAGAIN || errno == EINTR)
+				return;
+			/* A reader that quits early is not an error */
+			if (errno != EPIPE)
+				debug(D_WARN, "export failed: %s", strerror(errno));
+			export_stop();
+			return;
+		}
+		ex->off += n;
+		budget -= MIN(n, budget);
+	}
+}
+
+/*
+ * End the export, closing the reader's input.
+ */
+static void export_stop(void)
+{
+	Export *ex = term.export;
+
+	if (!ex)
+		return;
+
+	if (ex->polled)
+		loop_unwatch(ex->fd);
+	close(ex->fd);
+	mem_add(MEM_PARSER, -(long)(ex->size + sizeof(*ex)));
+	free(ex->buf);
+	free(ex);
+	term.export = NULL;
+}
+
+/*
+ * Encode a style as the SGR sequence setting it from the
+ * default, into s, which has room for SGR_SIZ bytes.
+ */
+static int sgr_string(const Style *style, char *s)
+{
+	uint color[2] = { style->fg, style->bg };
+	uint def[2] = { color_fg, color_bg };
+	int i, len = sprintf(s, "\033[0");
+
+	if (style->attr & ATTR_BOLD)
+		len += sprintf(s + len, ";1");
+	if (style->attr & ATTR_UNDERLINE)
+		len += sprintf(s + len, ";4");
+	if (style->attr & ATTR_REVERSE)
+		len += sprintf(s + len, ";7");
+	for (i = 0; i < 2; i++) {
+		if (color[i] == def[i])
+			continue;
+		if (IS_TRUECOLOR(color[i]))
+			len += sprintf(s + len, ";%d8;2;%d;%d;%d", 3 + i, TRUERED(color[i]),
+					TRUEGREEN(color[i]), TRUEBLUE(color[i]));
+		else
+			len += sprintf(s + len, ";%d8;5;%d", 3 + i, color[i]);
+	}
+	s[len++] = 'm';
+	return len;
+}
+
+/*
+ * Set the title of the frame of the window.
+ */
+static void set_title(char *title)
+{
+	XTextProperty prop;
+
+	XStringListToTextProperty(&title, 1, &prop);
+	XSetWMName(xw.display, win->frame->win, &prop);
+	XFree(prop.value);
+}
+
+static void set_urgency(int urgent)
+{
+	XWMHints *wm_hints = XGetWMHints(xw.display, win->frame->win);
+
+	MODBIT(wm_hints->flags, urgent, XUrgencyHint);
+	XSetWMHints(xw.display, win->frame->win, wm_hints);
+	XFree(wm_hints);
+}
+
+/*
+ * Set size hints for the frame of the window.
+ */
+static void set_hints(void)
+{
+	XSizeHints *size_hints;
+	XWMHints *wm_hints;
+	XClassHint *class_hints;
+
+	/* Size hints */
+	if (!(size_hints = XAllocSizeHints())) {
+		die("Failed to allocate window size hints");
+	}
+
+	/* WM hints */
+	if (!(wm_hints = XAllocWMHints())) {
+		die("Failed to allocate window wm hints");
+	}
+
+	/* Class hints */
+	if (!(class_hints = XAllocClassHint())) {
+		die("Failed to allocate window class hints");
+	}
+
+	size_hints->flags = PSize | PBaseSize | PResizeInc;
+	size_hints->width = xw.width;
+	size_hints->height = xw.height;
+	size_hints->base_width = 2 * xw.border;
+	size_hints->base_height = 2 * xw.border;
+	size_hints->width_inc = xw.cw;
+	size_hints->height_inc = xw.ch;
+	
+	/* Set position and gravity elements */
+	if (xw.geomask & (XValue|YValue)) {
+		size_hints->flags |= USPosition | PWinGravity;
+		size_hints->x = xw.x;
+		size_hints->y = xw.y;
+		size_hints->win_gravity = geomask_to_gravity(xw.geomask);
+	}
+
+	wm_hints->flags = InputHint;
+	wm_hints->input = True;
+
+	class_hints->res_name = res_name;
+	class_hints->res_class = res_class;
+
+	XSetWMNormalHints(xw.display, win->frame->win, size_hints);
+	XSetWMHints(xw.display, win->frame->win, wm_hints);
+	XSetClassHint(xw.display, win->frame->win, class_hints);
+
+	XFree(size_hints);
+	XFree(wm_hints);
+	XFree(class_hints);
+}
+
+/*
+ * Load the specified font, and get width & height.
+ */
+static void load_font(XFont *font, char *font_name)
+{
+	XFontStruct **fonts;
+	XFontSetExtents *font_extents;
+	char **missing_charset_list;
+	int missing_charset_count;
+	char *def_string;
+	char **font_name_list;
+	int i;
+	int num_fonts;
+	int ascent, descent;
+
+	/* Try to create font set structure */
+	font->font_set = XCreateFontSet(xw.display, font_name,
+			&missing_charset_list, &missing_charset_count,
+			&def_string);
+	if (!font->font_set) {
+		die("failed to create font set \"%s\"", font_name);
+	}
+	for (i = 0; i < missing_charset_count; i++) {
+		debug(D_WARN, "font for charset \"%s\" missing",
+				missing_charset_list[i]);
+	}
+
+	/* Get font metrics */
+	font_extents = XExtentsOfFontSet(font->font_set);
+	num_fonts = XFontsOfFontSet(font->font_set, &fonts, &font_name_list);
+	for (i = 0, ascent = 0, descent = 0; i < num_fonts; i++, fonts++) {
+		if (ascent < (*fonts)->ascent)
+			ascent = (*fonts)->ascent;
+		if (descent < (*fonts)->descent)
+			descent = (*fonts)->descent;
+		/* Xlib holds the metrics of every character of the font */
+		mem_add(MEM_FONTS, sizeof(**fonts) + ((*fonts)->per_char ?
+				((*fonts)->max_byte1 - (*fonts)->min_byte1 + 1) *
+				((*fonts)->max_char_or_byte2 - (*fonts)->min_char_or_byte2 + 1) *
+				(long)sizeof(XCharStruct) : 0));
+	}
+	font->ascent = ascent;
+	font->descent = descent;
+	font->width = font_extents->max_logical_extent.width;
+	font->height = font_extents->max_logical_extent.height;
+
+	xw.cw = font->width;
+	xw.ch = font->height;
+}
+
+/*
+ * Load the 256 color palette. On TrueColor visuals the pixel values
+ * are computed from the visual's masks, without any requests to the
+ * server; colors given as "#rrggbb" are also parsed locally.
+ */
+static void load_colors(void)
+{
+	ulong mask[3] = { xw.visual->red_mask, xw.visual->green_mask,
+		xw.visual->blue_mask };
+	XColor *color;
+	char *name;
+	int i, v;
+
+	dc.truecolor = (xw.visual->class == TrueColor);
+	for (i = 0; dc.truecolor && i < 3; i++) {
+		for (dc.shift[i] = 0; !(mask[i] & 1); mask[i] >>= 1)
+			dc.shift[i]++;
+		for (dc.bits[i] = 0; mask[i] & 1; mask[i] >>= 1)
+			dc.bits[i]++;
+	}
+
+	for (i = 0; i < 256; i++) {
+		color = &dc.colors[i];
+
+		if (i < 16) {
+			/* Use resource color, if set */
+			name = DEFAULT(xres.colors[i], color_names[i]);
+			if (!XParseColor(xw.display, xw.colormap, name, color))
+				die("Failed to parse color \"%s\"", name);
+		} else if (i < 232) {
+			/* xterm color cube [16-231]: levels 0, 0x5f, 0x87 ... 0xff */
+			v = i - 16;
+			color->red = (v / 36) ? (0x37 + 0x28 * (v / 36)) * 0x101 : 0;
+			color->green = ((v / 6) % 6) ? (0x37 + 0x28 * ((v / 6) % 6)) * 0x101 : 0;
+			color->blue = (v % 6) ? (0x37 + 0x28 * (v % 6)) * 0x101 : 0;
+		} else {
+			/* xterm grayscale colors [232-255] */
+			color->red = 0x0808 + 0x0a0a * (i - 232);
+			color->blue = color->green = color->red;
+		}
+
+		if (dc.truecolor)
+			color->pixel = rgb_pixel(color->red, color->green, color->blue);
+		else if (!XAllocColor(xw.display, xw.colormap, color))
+			die("Failed to allocate color %d", i);
+	}
+}
+
+/*
+ * Compute the pixel value of a 16-bit per channel color
+ * on a TrueColor visual.
+ */
+static ulong rgb_pixel(ushort red, ushort green, ushort blue)
+{
+	return (ulong)(red >> (16 - dc.bits[0])) << dc.shift[0] |
+		(ulong)(green >> (16 - dc.bits[1])) << dc.shift[1] |
+		(ulong)(blue >> (16 - dc.bits[2])) << dc.shift[2];
+}
+
+/*
+ * Get the pixel value of a palette index or TRUECOLOR() color.
+ * 24-bit colors are never allocated: without a TrueColor visual
+ * they are mapped to the nearest color of the xterm color cube.
+ */
+static ulong xpixel(uint color)
+{
+	if (IS_TRUECOLOR(color) && dc.truecolor) {
+		return rgb_pixel(TRUERED(color) * 0x101, TRUEGREEN(color) * 0x101,
+				TRUEBLUE(color) * 0x101);
+	}
+	return dc.colors[color_cube(color)].pixel;
+}
+
+/*
+ * Get the palette index of the xterm color cube
+ * nearest to a TRUECOLOR() color.
+ */
+static uint color_cube(uint color)
+{
+	int level[3], i;
+
+	if (!IS_TRUECOLOR(color))
+		return color;
+
+	level[0] = TRUERED(color);
+	level[1] = TRUEGREEN(color);
+	level[2] = TRUEBLUE(color);
+	for (i = 0; i < 3; i++)
+		level[i] = (level[i] < 0x30) ? 0 : (level[i] < 0x73) ? 1 : (level[i] - 0x23) / 0x28;
+
+	return 16 + 36 * level[0] + 6 * level[1] + level[2];
+}
+
+/*
+ * Clear region of the window (column,row coordinates).
+ */
+static void xwindow_clear(int col1, int row1, int col2, int row2)
+{
+	if (xw.shmimg) {
+		shm_fill(xw.border + col1 * xw.cw, xw.border + row1 * xw.ch,
+				(col2-col1+1) * xw.cw, (row2-row1+1) * xw.ch,
+				dc.colors[color_bg].pixel);
+		return;
+	}
+
+	XSetForeground(xw.display, dc.gc, dc.colors[color_bg].pixel);
+	XFillRectangle(xw.display, xw.drawbuf, dc.gc,
+			xw.border + col1 * xw.cw,
+			xw.border + row1 * xw.ch,
+			(col2-col1+1) * xw.cw,
+			(row2-row1+1) * xw.ch);
+}
+
+/*
+ * Clear region of the window (absolute x,y coordinates).
+ */
+static void xwindow_abs_clear(int x1, int y1, int x2, int y2)
+{
+	xwindow_fill(x1, y1, x2-x1, y2-y1, dc.colors[color_bg].pixel);
+}
+
+/*
+ * Fill a rectangle of the drawing buffer with a color.
+ */
+static void xwindow_fill(int x, int y, int w, int h, ulong pixel)
+{
+	if (xw.shmimg) {
+		shm_fill(x, y, w, h, pixel);
+		return;
+	}
+
+	XSetForeground(xw.display, dc.gc, pixel);
+	XFillRectangle(xw.display, xw.drawbuf, dc.gc, x, y, w, h);
+}
+
+/*
+ * Resize X window.
+ */
+static void xwindow_resize(int cols, int rows)
+{
+	/* The next frame rebuilds drawbuf in the new dimensions */
+	xwindow_release();
+	xw.scrolln = 0;
+	xw.shifted = False;
+
+	memset(term.drawn, 0, term.rows * sizeof(*term.drawn));
+	term_fulldirty();
+}
+
+/*
+ * Create the drawing buffer of the loaded window, filled with the
+ * background color: a shared memory image the glyphs are rasterized
+ * into if possible, a pixmap drawn with core X requests otherwise.
+ */
+static void xwindow_buffer(void)
+{
+	if (!atlas.cov || !shm_create()) {
+		xw.drawbuf = XCreatePixmap(xw.display, xw.win, xw.width, xw.height,
+				DefaultDepth(xw.display, xw.screen));
+		xw.bufmem = pixmap_size(xw.width, xw.height);
+		mem_add(MEM_PIXMAPS, xw.bufmem);
+	}
+
+	xwindow_abs_clear(0, 0, xw.width, xw.height);
+}
+
+/*
+ * Free the drawing buffer and row cache of the loaded window. draw()
+ * rebuilds the buffer, with a full repaint, when the window is visible.
+ */
+static void xwindow_release(void)
+{
+	if (xw.shmimg) {
+		shm_destroy();
+	} else if (xw.drawbuf) {
+		XFreePixmap(xw.display, xw.drawbuf);
+		mem_add(MEM_PIXMAPS, -xw.bufmem);
+	}
+	xw.drawbuf = None;
+
+	if (xw.cache) {
+		XFreePixmap(xw.display, xw.cachepix);
+		free(xw.cache);
+		xw.cache = NULL;
+		mem_add(MEM_GLYPHS, -row_cache * (long)sizeof(*xw.cache));
+		mem_add(MEM_PIXMAPS, -xw.cachemem);
+	}
+}
+
+/*
+ * Stop drawing the loaded window, which is unmapped or fully
+ * obscured. The parser keeps the terminal up to date meanwhile.
+ */
+static void xwindow_hide(void)
+{
+	if (xw.state & WIN_VISIBLE)
+		clock_gettime(CLOCK_MONOTONIC, &xw.hidetime);
+	xw.state &= ~WIN_VISIBLE;
+}
+
+/*
+ * Render the ASCII glyphs into a pixmap with the core font, and read
+ * back their coverage in a single round-trip. Other glyphs are added
+ * to the atlas when they are first drawn.
+ */
+static void atlas_init(void)
+{
+	Pixmap strip;
+	XImage *img;
+	int c;
+	char s;
+
+	strip = XCreatePixmap(xw.display, XRootWindow(xw.display, xw.screen),
+			128 * xw.cw, xw.ch, DefaultDepth(xw.display, xw.screen));
+	XSetForeground(xw.display, dc.gc, BlackPixel(xw.display, xw.screen));
+	XFillRectangle(xw.display, strip, dc.gc, 0, 0, 128 * xw.cw, xw.ch);
+	XSetForeground(xw.display, dc.gc, WhitePixel(xw.display, xw.screen));
+	for (c = 0x20; c < 0x7f; c++) {
+		s = c;
+		Xutf8DrawString(xw.display, strip, dc.font.font_set, dc.gc,
+				c * xw.cw, dc.font.ascent, &s, 1);
+	}
+	img = XGetImage(xw.display, strip, 0, 0, 128 * xw.cw, xw.ch,
+			AllPlanes, ZPixmap);
+	XFreePixmap(xw.display, strip);
+	if (!img) {
+		debug(D_WARN, "could not read glyphs, using core X drawing");
+		return;
+	}
+
+	atlas.size = 256;
+	atlas.cov = malloc(atlas.size * xw.cw * xw.ch);
+	mem_add(MEM_GLYPHS, atlas.size * xw.cw * xw.ch);
+	for (c = 0; c < 128; c++)
+		atlas_read(img, c * xw.cw, c);
+	atlas.nslots = 128;
+	XDestroyImage(img);
+
+	atlas.mapsize = 64;
+	atlas.map = calloc(atlas.mapsize, sizeof(*atlas.map));
+	mem_add(MEM_GLYPHS, atlas.mapsize * sizeof(*atlas.map));
+	atlas.scratch = XCreatePixmap(xw.display, XRootWindow(xw.display, xw.screen),
+			2 * xw.cw, xw.ch, DefaultDepth(xw.display, xw.screen));
+	mem_add(MEM_PIXMAPS, pixmap_size(2 * xw.cw, xw.ch));
+}
+
+/*
+ * Store the coverage of the cell at x in a glyph image (white on
+ * black) into a slot: the green channel, scaled to 0-255.
+ */
+static void atlas_read(XImage *img, int x, int slot)
+{
+	uchar *cov = atlas.cov + slot * xw.cw * xw.ch;
+	int i, j, max = (1 << dc.bits[1]) - 1;
+
+	for (j = 0; j < xw.ch; j++)
+		for (i = 0; i < xw.cw; i++)
+			*cov++ = ((XGetPixel(img, x + i, j) >> dc.shift[1]) & max) * 255 / max;
+}
+
+/*
+ * Get the slot of a glyph, rendering it on first use.
+ * Wide glyphs take two slots. Returns -1 for a blank glyph.
+ */
+static int atlas_glyph(Rune r)
+{
+	Glyph *map;
+	XImage *img;
+	char buf[UTF_SIZ];
+	int i, slot, width, size;
+
+	if (r < 0x80)
+		return r;
+
+	for (i = (r * 2654435761u) & (atlas.mapsize - 1); atlas.map[i].r;
+			i = (i + 1) & (atlas.mapsize - 1)) {
+		if (atlas.map[i].r == r)
+			return atlas.map[i].slot;
+	}
+
+	/* Render the glyph */
+	width = UNI_WIDTH(uniprop(r)) == 2 ? 2 : 1;
+	XSetForeground(xw.display, dc.gc, BlackPixel(xw.display, xw.screen));
+	XFillRectangle(xw.display, atlas.scratch, dc.gc, 0, 0, 2 * xw.cw, xw.ch);
+	XSetForeground(xw.display, dc.gc, WhitePixel(xw.display, xw.screen));
+	Xutf8DrawString(xw.display, atlas.scratch, dc.font.font_set, dc.gc,
+			0, dc.font.ascent, buf, utf8_encode(r, buf));
+	img = XGetImage(xw.display, atlas.scratch, 0, 0, width * xw.cw, xw.ch,
+			AllPlanes, ZPixmap);
+	if (img) {
+		if (atlas.nslots + width > atlas.size) {
+			mem_add(MEM_GLYPHS, atlas.size * xw.cw * xw.ch);
+			atlas.size *= 2;
+			atlas.cov = realloc(atlas.cov, atlas.size * xw.cw * xw.ch);
+		}
+		slot = atlas.nslots;
+		for (i = 0; i < width; i++)
+			atlas_read(img, i * xw.cw, atlas.nslots++);
+		XDestroyImage(img);
+	} else {
+		slot = -1;
+	}
+
+	/* Keep the map at most three quarters full */
+	if (4 * (atlas.nmap + 1) > 3 * atlas.mapsize) {
+		map = atlas.map;
+		size = atlas.mapsize;
+		atlas.mapsize *= 2;
+		atlas.map = calloc(atlas.mapsize, sizeof(*atlas.map));
+		mem_add(MEM_GLYPHS, size * sizeof(*atlas.map));
+		atlas.nmap = 0;
+		for (i = 0; i < size; i++)
+			if (map[i].r)
+				atlas_insert(map[i].r, map[i].slot);
+		free(map);
+	}
+	atlas_insert(r, slot);
+
+	return slot;
+}
+
+/*
+ * Add a glyph to the map of the atlas.
+ */
+static void atlas_insert(Rune r, int slot)
+{
+	int i;
+
+	for (i = (r * 2654435761u) & (atlas.mapsize - 1); atlas.map[i].r;
+			i = (i + 1) & (atlas.mapsize - 1))
+		;
+	atlas.map[i] = (Glyph){ .r = r, .slot = slot };
+	atlas.nmap++;
+}
+
+static int shm_error;
+
+static int shm_error_handler(Display *display, XErrorEvent *ev)
+{
+	shm_error = ev->error_code;
+	return 0;
+}
+
+/*
+ * Create the shared memory image of the loaded window. Fails if the
+ * image layout is not handled, or if the server cannot attach the
+ * segment (e.g. on a remote display).
+ */
+static Bool shm_create(void)
+{
+	XImage *img;
+	int (*handler)(Display *, XErrorEvent *);
+	union { uint32_t i; uchar c; } host = { 1 };
+
+	img = XShmCreateImage(xw.display, xw.visual,
+			DefaultDepth(xw.display, xw.screen), ZPixmap, NULL,
+			&xw.shminfo, xw.width, xw.height);
+	if (!img)
+		return False;
+	/* Pixels are written as 32-bit words in host byte order */
+	if (img->bits_per_pixel != 32 ||
+			img->byte_order != (host.c ? LSBFirst : MSBFirst)) {
+		XDestroyImage(img);
+		return False;
+	}
+
+	xw.shminfo.shmid = shmget(IPC_PRIVATE, img->bytes_per_line * img->height,
+			IPC_CREAT | 0600);
+	if (xw.shminfo.shmid < 0) {
+		XDestroyImage(img);
+		return False;
+	}
+	xw.shminfo.shmaddr = img->data = shmat(xw.shminfo.shmid, NULL, 0);
+	xw.shminfo.readOnly = False;
+	if (img->data == (void *)-1) {
+		shmctl(xw.shminfo.shmid, IPC_RMID, NULL);
+		img->data = NULL;
+		XDestroyImage(img);
+		return False;
+	}
+
+	/* Catch the error of an attach that fails */
+	XSync(xw.display, False);
+	shm_error = 0;
+	handler = XSetErrorHandler(shm_error_handler);
+	XShmAttach(xw.display, &xw.shminfo);
+	XSync(xw.display, False);
+	XSetErrorHandler(handler);
+	/* The segment is freed once both sides have detached */
+	shmctl(xw.shminfo.shmid, IPC_RMID, NULL);
+
+	if (shm_error) {
+		debug(D_WARN, "could not attach shared memory, using core X drawing");
+		shmdt(xw.shminfo.shmaddr);
+		img->data = NULL;
+		XDestroyImage(img);
+		return False;
+	}
+
+	xw.shmimg = img;
+	xw.bufmem = img->bytes_per_line * img->height;
+	mem_add(MEM_SHM, xw.bufmem);
+	return True;
+}
+
+/*
+ * Free the shared memory image of the loaded window. Puts still
+ * pending are waited for, and their completions taken off the
+ * queue, so that they aren't counted against the next image.
+ */
+static void shm_destroy(void)
+{
+	XEvent ev;
+
+	if (xw.shmpending > 0) {
+		XSync(xw.display, False);
+		while (xw.shmpending > 0 &&
+				XCheckTypedWindowEvent(xw.display, xw.win, dc.shmevent, &ev))
+			xw.shmpending--;
+	}
+
+	XShmDetach(xw.display, &xw.shminfo);
+	shmdt(xw.shminfo.shmaddr);
+	xw.shmimg->data = NULL;
+	XDestroyImage(xw.shmimg);
+	xw.shmimg = NULL;
+	mem_add(MEM_SHM, -xw.bufmem);
+}
+
+/*
+ * Fill a rectangle of the shared memory image (pixel coordinates).
+ */
+static void shm_fill(int x, int y, int w, int h, ulong pixel)
+{
+	uint32_t *p;
+	int i;
+	int x2 = MIN(x + w, xw.shmimg->width);
+	int y2 = MIN(y + h, xw.shmimg->height);
+
+	for (y = MAX(y, 0), x = MAX(x, 0); y < y2; y++) {
+		p = (uint32_t *)(xw.shmimg->data + y * xw.shmimg->bytes_per_line);
+		for (i = x; i < x2; i++)
+			p[i] = pixel;
+	}
+}
+
+/*
+ * Rasterize len cells into the shared memory image, with the first
+ * one at pixel position x, y. The coverage of the run is gathered
+ * from the atlas row by row, and blended in one go.
+ */
+static void shm_draw(int x, int y, Rune *s, int len, ulong fg, ulong bg,
+		Bool underline)
+{
+	XImage *img = xw.shmimg;
+	int i, row;
+
+	/* Clip to the image */
+	if (y + xw.ch > img->height)
+		return;
+	len = MIN(len, (img->width - x) / xw.cw);
+	if (len <= 0)
+		return;
+
+	uchar cov[len * xw.cw], *c, *g;
+	int slot[len];
+	const Rune *rs;
+	int j, k, n;
+
+	/* The cell covered by a wide glyph takes its second slot */
+	for (i = 0; i < len; i++) {
+		if (s[i] != WIDE_TAIL)
+			slot[i] = atlas_glyph(*cell_runes(&s[i], &n));
+		else
+			slot[i] = (i > 0 && slot[i-1] >= 0) ? slot[i-1] + 1 : -1;
+	}
+
+	for (row = 0; row < xw.ch; row++) {
+		for (i = 0; i < len; i++) {
+			c = cov + i * xw.cw;
+			if (slot[i] < 0)
+				memset(c, 0, xw.cw);
+			else
+				memcpy(c, atlas.cov + (slot[i] * xw.ch + row) * xw.cw, xw.cw);
+			if (!IS_CLUSTER(s[i]))
+				continue;
+			/* Overstrike the rest of a cluster */
+			rs = cell_runes(&s[i], &n);
+			for (k = 1; k < n; k++) {
+				if ((j = atlas_glyph(rs[k])) < 0)
+					continue;
+				g = atlas.cov + (j * xw.ch + row) * xw.cw;
+				for (j = 0; j < xw.cw; j++)
+					c[j] = MAX(c[j], g[j]);
+			}
+		}
+		shm_blend((uint32_t *)(img->data + (y + row) * img->bytes_per_line) + x,
+				cov, len * xw.cw, fg, bg);
+	}
+
+	if (underline)
+		shm_fill(x, y + dc.font.ascent + 1, len * xw.cw, 1, fg);
+}
+
+#ifdef __SSE2__
+/*
+ * Blend two pixels (16 bits per channel) by their coverage a.
+ */
+static inline __m128i shm_blend2(__m128i a, __m128i fg, __m128i bg)
+{
+	__m128i x;
+
+	x = _mm_add_epi16(_mm_mullo_epi16(fg, a),
+			_mm_mullo_epi16(bg, _mm_sub_epi16(_mm_set1_epi16(255), a)));
+	x = _mm_add_epi16(x, _mm_set1_epi16(128));
+	return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+}
+#endif
+
+/*
+ * Blend n pixels of fg over bg by their coverage: every channel
+ * becomes (fg * a + bg * (255 - a)) / 255, rounded. Four pixels
+ * at a time with SSE2.
+ */
+static void shm_blend(uint32_t *dst, const uchar *cov, int n,
+		uint32_t fg, uint32_t bg)
+{
+	uint32_t p, x;
+	int i = 0, c;
+#ifdef __SSE2__
+	__m128i zero = _mm_setzero_si128();
+	__m128i fg16 = _mm_unpacklo_epi8(_mm_set1_epi32(fg), zero);
+	__m128i bg16 = _mm_unpacklo_epi8(_mm_set1_epi32(bg), zero);
+	__m128i a;
+	int32_t a4;
+
+	for (; i + 4 <= n; i += 4) {
+		/* Spread the coverage of each pixel over its channels */
+		memcpy(&a4, cov + i, sizeof(a4));
+		a = _mm_cvtsi32_si128(a4);
+		a = _mm_unpacklo_epi8(a, a);
+		a = _mm_unpacklo_epi16(a, a);
+		_mm_storeu_si128((__m128i *)(dst + i), _mm_packus_epi16(
+				shm_blend2(_mm_unpacklo_epi8(a, zero), fg16, bg16),
+				shm_blend2(_mm_unpackhi_epi8(a, zero), fg16, bg16)));
+	}
+#endif
+
+	for (; i < n; i++) {
+		for (p = 0, c = 0; c < 32; c += 8) {
+			x = (fg >> c & 0xff) * cov[i] + (bg >> c & 0xff) * (255 - cov[i]) + 128;
+			p |= ((x + (x >> 8)) >> 8) << c;
+		}
+		dst[i] = p;
+	}
+}
+
+/*
+ * Push the dirty rows of the drawing buffer to the window, one request
+ * per run of adjacent rows. Runs at the edges take the border along.
+ * Drawing into a shared memory image waits for the server to complete
+ * the puts.
+ */
+static void xwindow_put(void)
+{
+	uint64_t start = trace_now();
+	int row, end, y1, y2, n = 0;
+
+	for (row = 0; row < term.rows; row = end + 1) {
+		for (end = row; end < term.rows && term.dirty[end]; end++)
+			;
+		if (end == row)
+			continue;
+
+		y1 = (row == 0) ? 0 : xw.border + row * xw.ch;
+		y2 = (end == term.rows) ? xw.height : xw.border + end * xw.ch;
+		xwindow_copy(0, y1, xw.width, y2 - y1);
+		n++;
+	}
+	trace_span("xwindow_put", start, "rects", n);
+}
+
+/*
+ * Push a rectangle of the drawing buffer to the window.
+ */
+static void xwindow_copy(int x, int y, int w, int h)
+{
+	w = MIN(w, xw.width - x);
+	h = MIN(h, xw.height - y);
+	if (w <= 0 || h <= 0)
+		return;
+
+	if (xw.shmimg) {
+		XShmPutImage(xw.display, xw.win, dc.gc, xw.shmimg,
+				x, y, x, y, w, h, True);
+		xw.shmpending++;
+	} else {
+		XCopyArea(xw.display, xw.drawbuf, xw.win, dc.gc, x, y, w, h, x, y);
+	}
+}
+
+/*
+ * Move rows top to bottom of the drawing buffer n rows down, or up for
+ * negative n, along with their fingerprints. Rows left behind are
+ * repainted, and the next frame pushes all of them.
+ */
+static void xwindow_shift(int top, int bot, int n)
+{
+	int height = bot - top + 1, rows = height - abs(n);
+	int src = top + ((n < 0) ? -n : 0), dst = top + ((n > 0) ? n : 0);
+	int vacated = (n > 0) ? top : top + rows, bpl;
+
+	xw.shifttop = xw.shifted ? MIN(xw.shifttop, top) : top;
+	xw.shiftbot = xw.shifted ? MAX(xw.shiftbot, bot) : bot;
+	xw.shifted = True;
+
+	/* The cursor moves along, or out of the buffer */
+	if (BETWEEN(xw.curdrawn.y, top, bot)) {
+		xw.curdrawn.y += n;
+		if (!BETWEEN(xw.curdrawn.y, top, bot))
+			xw.curshape = CURSOR_NONE;
+	}
+
+	if (rows <= 0) {
+		memset(term.drawn + top, 0, height * sizeof(*term.drawn));
+		term_setdirty(top, bot);
+		return;
+	}
+
+	memmove(term.drawn + dst, term.drawn + src, rows * sizeof(*term.drawn));
+	memset(term.drawn + vacated, 0, abs(n) * sizeof(*term.drawn));
+	term_setdirty(vacated, vacated + abs(n) - 1);
+
+	if (xw.shmimg) {
+		bpl = xw.shmimg->bytes_per_line;
+		memmove(xw.shmimg->data + (xw.border + dst * xw.ch) * bpl,
+				xw.shmimg->data + (xw.border + src * xw.ch) * bpl,
+				rows * xw.ch * bpl);
+	} else if (xw.drawbuf) {
+		XCopyArea(xw.display, xw.drawbuf, xw.drawbuf, dc.gc,
+				0, xw.border + src * xw.ch, xw.width, rows * xw.ch,
+				0, xw.border + dst * xw.ch);
+	}
+}
+
+/*
+ * Have the next frame shift rows top to bottom of the drawing buffer
+ * n rows down, as the screen scrolled. Scrolls of the same rows add
+ * up, so that a frame costs a single shift however far they went.
+ */
+static void xwindow_scroll(int top, int bot, int n)
+{
+	if (xw.scrolln && (top != xw.scrolltop || bot != xw.scrollbot)) {
+		xwindow_shift(xw.scrolltop, xw.scrollbot, xw.scrolln);
+		xw.scrolln = 0;
+	}
+	xw.scrolltop = top;
+	xw.scrollbot = bot;
+	xw.scrolln += n;
+	LIMIT(xw.scrolln, top - bot - 1, bot - top + 1);
+}
+
+/*
+ * Resize terminal and X window.
+ */
+static void resize_all(int width, int height)
+{
+	uint64_t start = trace_now();
+	int cols, rows;
+
+	if (width != 0)
+		xw.width = width;
+	if (height != 0)
+		xw.height = height;
+
+	cols = (xw.width - 2* xw.border) / xw.cw;
+	rows = (xw.height - 2 * xw.border) / xw.ch;
+
+	/* Resize term (internal), X window, and tty */
+	term_resize(cols, rows);
+	xwindow_resize(cols, rows);
+	tty_resize(cols, rows);
+	trace_span("resize", start, "rows", rows);
+
+	DEBUG("Window resized: width = %d, height = %d, cols=%d, rows=%d",
+			xw.width, xw.height, cols, rows);
+}
+
+/*
+ * Convert a geometry mask to a gravity.
+ */
+static int geomask_to_gravity(int mask)
+{
+	switch (mask & (XNegative|YNegative)) {
+	case 0:
+		return NorthWestGravity;
+	case XNegative:
+		return NorthEastGravity;
+	case YNegative:
+		return SouthWestGravity;
+	}
+	return SouthEastGravity;
+}
+
+/*
+ * Open the display and load what the size of a window depends on.
+ */
+static void x_init(void)
+{
+	XrmDatabase serverDB;
+	char *s;
+
+	/* Open connection to X server */
+	if (!(xw.display = XOpenDisplay(xw.display_name)))
+		die("Cannot open X display \"%s\"", XDisplayName(xw.display_name));
+	trace_phase("display opened");
+
+	/* Get default screen and visual */
+	xw.screen = XDefaultScreen(xw.display);
+	xw.visual = XDefaultVisual(xw.display, xw.screen);
+	xw.colormap = XDefaultColormap(xw.display, xw.screen);
+
+	/* Initialize rDB resources database */
+	XrmInitialize();
+	/* Get the resources from the server, if any */
+	if ((s = XResourceManagerString(xw.display)) != NULL) {
+		serverDB = XrmGetStringDatabase(s);
+		XrmMergeDatabases(serverDB, &rDB);
+
+		memset(&xres, 0, sizeof(xres));
+		/* Get all resources from database */
+		extract_resources();
+	}
+
+	/* Load font, in order:
+	 * 1. Resource database
+	 * 2. Commandline
+	 * 3. Default
+	 */
+	dc.font.name = DEFAULT(xres.font.name, DEFAULT(dc.font.name, DEFAULT_FONT));
+	load_font(&dc.font, dc.font.name);
+	trace_phase("font loaded");
+
+	DEBUG("font width = %d", xw.cw);
+	DEBUG("font height = %d", xw.ch);
+
+	/* New windows start from the shared state */
+	xwdef = xw;
+}
+
+/*
+ * Set up the rest of the X state shared by all windows. Without
+ * termd this runs while the first window's command starts up.
+ */
+static void x_setup(void)
 {
-	if (sel.primary)
-		free(sel.primary);
+	XGCValues gcvalues;
+	char *names[LEN(atoms)];
+	Atom values[LEN(atoms)];
+	int i;
 
-	/* TODO: get text selection for primary */
-	sel.primary = strdup("text");
+	/* Colors */
+	load_colors();
+	trace_phase("colors loaded");
 
-	if (sel_own(XA_PRIMARY, time))
-		sel.sel_time = time;
+	/* Graphics context */
+	memset(&gcvalues, 0, sizeof(gcvalues));
+	gcvalues.graphics_exposures = False;
+	dc.gc = XCreateGC(xw.display, XRootWindow(xw.display, xw.screen),
+			GCGraphicsExposures, &gcvalues);
+
+	/* Glyphs for the shared memory renderer */
+	if (shm_render && dc.truecolor && XShmQueryExtension(xw.display)) {
+		atlas_init();
+		dc.shmevent = XShmGetEventBase(xw.display) + ShmCompletion;
+		trace_phase("glyphs rendered");
+	}
+
+	/* Input method(s) */
+	XSetLocaleModifiers("");
+	if (!( xw.xim = XOpenIM(xw.display, rDB, res_name, res_class))) {
+		XSetLocaleModifiers("@im=local");
+		if (!( xw.xim = XOpenIM(xw.display, rDB, res_name, res_class))) {
+			XSetLocaleModifiers("@im=");
+			if (!( xw.xim = XOpenIM(xw.display, rDB, res_name, res_class)))
+				die("could not open input device");
+		}
+	}
+	trace_phase("input method opened");
+
+	/* Get atom(s), in a single round-trip */
+	for (i = 0; i < LEN(atoms); i++)
+		names[i] = atoms[i].name;
+	if (!XInternAtoms(xw.display, names, LEN(atoms), False, values))
+		die("failed to intern atoms");
+	for (i = 0; i < LEN(atoms); i++)
+		*atoms[i].atom = values[i];
+	trace_phase("atoms interned");
+
+	/* Windows created from now on share this state too */
+	xwdef.xim = xw.xim;
 }
 
 /*
- * Set the title of the window.
+ * Create the X window of the loaded window, and that of its frame
+ * if it is new. They are set up and mapped by xwindow_map().
  */
-static void set_title(char *title)
+static void xwindow_create(void)
 {
-	XTextProperty prop;
+	Frame *f = win->frame;
+	Layout *l = win->layout;
 
-	XStringListToTextProperty(&title, 1, &prop);
-	XSetWMName(xw.display, xw.win, &prop);
-	XFree(prop.value);
+	/* Window attributes */
+	xw.attrs.background_pixel = BlackPixel(xw.display, xw.screen);
+	xw.attrs.border_pixel = BlackPixel(xw.display, xw.screen);
+	xw.attrs.colormap = xw.colormap;
+	xw.attrs.bit_gravity = NorthWestGravity;
+
+	/* A new frame, which the pane fills */
+	if (!f->win) {
+		/* Window geometry */
+		xw.width = term.cols * xw.cw + 2 * xw.border;
+		xw.height = term.rows * xw.ch + 2 * xw.border;
+		/* Convert negative coordinates to absolute */
+		if (xw.geomask & XNegative)
+			xw.x += DisplayWidth(xw.display, xw.screen) - xw.width;
+		if (xw.geomask & YNegative)
+			xw.y += DisplayHeight(xw.display, xw.screen) - xw.height;
+
+		xw.parent = DEFAULT(xw.parent, XRootWindow(xw.display, xw.screen));
+
+		xw.attrs.event_mask = FRAME_MASK;
+		f->win = XCreateWindow(xw.display, xw.parent,
+				xw.x, xw.y, xw.width, xw.height, 0,
+				XDefaultDepth(xw.display, xw.screen), InputOutput,
+				xw.visual, CWBackPixel | CWBorderPixel | CWEventMask
+				| CWColormap, &xw.attrs);
+		f->width = xw.width;
+		f->height = xw.height;
+		frame_place(l, 0, 0, xw.width, xw.height);
+	}
+
+	xw.width = l->width;
+	xw.height = l->height;
+	xw.attrs.event_mask = EVENT_MASK;
+	xw.win = XCreateWindow(xw.display, f->win,
+			l->x, l->y, xw.width, xw.height, 0,
+			XDefaultDepth(xw.display, xw.screen), InputOutput,
+			xw.visual, CWBackPixel | CWBorderPixel | CWBitGravity
+			| CWEventMask | CWColormap, &xw.attrs);
+
+	trace_phase("window created");
 }
 
-static void set_urgency(int urgent)
+/*
+ * Set up and map the X window of the loaded window, and its frame
+ * if that is new. Needs the state set up by x_setup().
+ */
+static void xwindow_map(void)
 {
-	XWMHints *wm_hints = XGetWMHints(xw.display, xw.win);
+	Frame *f = win->frame;
+	pid_t pid = getpid();
 
-	MODBIT(wm_hints->flags, urgent, XUrgencyHint);
-	XSetWMHints(xw.display, xw.win, wm_hints);
-	XFree(wm_hints);
+	sel_init();
+
+	/* Input context: keys are typed into the frame */
+	xw.xic = XCreateIC(xw.xim, XNInputStyle, XIMPreeditNothing | XIMStatusNothing,
+			XNClientWindow, f->win, XNFocusWindow, f->win, NULL);
+	if (!xw.xic)
+		die("could not create input context");
+
+	XMapWindow(xw.display, xw.win);
+	if (f->mapped)
+		return;
+	f->mapped = True;
+
+	/* The gap between panes shows the frame */
+	XSetWindowBackground(xw.display, f->win, dc.colors[pane_color].pixel);
+
+	XSetWMProtocols(xw.display, f->win, &wmdeletewin_atom, 1);
+	XChangeProperty(xw.display, f->win, netwmpid_atom, XA_CARDINAL, 32,
+			PropModeReplace, (uchar *)&(pid), 1);
+
+	/* (Re)set window title */
+	set_title("term");
+
+	/* Map window and set hints */
+	XMapWindow(xw.display, f->win);
+	set_hints();
+
+	/* No need to wait for the server: MapNotify arrives in main_loop() */
+	XFlush(xw.display);
+	trace_phase("map requested");
 }
 
 /*
- * Set size hints for window.
+ * Create a new window with the given options, load it and start its
+ * command. The window is shown by xwindow_map(). It is a pane of
+ * opts->frame, in the place opts->layout, or else of a new frame.
  */
-static void set_hints(void)
+static void win_new(WinOpts *opts)
 {
-	XSizeHints *size_hints;
-	XWMHints *wm_hints;
-	XClassHint *class_hints;
+	uint cols = DEFAULT_COLS, rows = DEFAULT_ROWS;
+	int mask;
+	Win *w;
+	Frame *f;
+
+	if (!(w = calloc(1, sizeof(*w))))
+		die("calloc failed: %s", strerror(errno));
+	mem_add(MEM_SCREEN, sizeof(*w));
+
+	win_load(w);
+	xw = xwdef;
+	tty.fd = -1;
+	tty.cmd = opts->cmd;
+	tty.cwd = opts->cwd;
+	tty.env = opts->env;
+
+	if ((f = opts->frame)) {
+		/* A pane of a frame takes the size of its place */
+		w->frame = f;
+		w->layout = opts->layout;
+		w->layout->pane = w;
+		cols = MAX((w->layout->width - 2 * xw.border) / xw.cw, 1);
+		rows = MAX((w->layout->height - 2 * xw.border) / xw.ch, 1);
+	} else {
+		frame_new(w);
+
+		/* Geometry, in order: commandline, resource database, default */
+		if (xres.geometry)
+			xw.geomask = XParseGeometry(xres.geometry, &xw.x, &xw.y, &cols, &rows);
+		if (opts->geometry) {
+			mask = XParseGeometry(opts->geometry, &xw.x, &xw.y, &cols, &rows);
+			if (mask & XValue)
+				xw.geomask &= ~XNegative;
+			if (mask & YValue)
+				xw.geomask &= ~YNegative;
+			xw.geomask |= mask;
+		}
+		xw.parent = opts->parent;
+	}
 
-	/* Size hints */
-	if (!(size_hints = XAllocSizeHints())) {
-		die("Failed to allocate window size hints");
+	term_init(cols, rows);
+	xwindow_create();
+
+	/* Start the command now, so that it starts up while
+	 * the window is set up and mapped */
+	tty_init();
+	loop_watch(tty_pollfd(), w);
+	trace_phase("command forked");
+
+	w->next = wins;
+	wins = w;
+}
+
+/*
+ * Load the state of a window into the globals, saving
+ * the state of the previously loaded window.
+ */
+static void win_load(Win *w)
+{
+	if (w == win)
+		return;
+
+	if (win) {
+		win->tty = tty;
+		win->term = term;
+		win->xw = xw;
+		win->sel = sel;
+		win->hint = hint;
 	}
 
-	/* WM hints */
-	if (!(wm_hints = XAllocWMHints())) {
-		die("Failed to allocate window wm hints");
+	tty = w->tty;
+	term = w->term;
+	xw = w->xw;
+	sel = w->sel;
+	hint = w->hint;
+	win = w;
+}
+
+/*
+ * Find the window with the given X window.
+ */
+static Win *win_find(Window xwin)
+{
+	Win *w;
+
+	for (w = wins; w; w = w->next) {
+		if ((w == win ? xw.win : w->xw.win) == xwin)
+			return w;
 	}
+	return NULL;
+}
 
-	/* Class hints */
-	if (!(class_hints = XAllocClassHint())) {
-		die("Failed to allocate window class hints");
+/*
+ * Destroy a window and free its state. Without termd,
+ * closing the last window exits with the given status.
+ */
+static void win_close(Win *w, int status)
+{
+	Frame *f = w->frame;
+	Layout *l = w->layout;
+	Win **p;
+
+	win_load(w);
+
+	if (tty.ring)
+		ring_free();
+	if (tty.fd >= 0) {
+		loop_unwatch(tty.fd);
+		close(tty.fd);
+	}
+	XDestroyIC(xw.xic);
+	xwindow_release();
+	XDestroyWindow(xw.display, xw.win);
+	term_free();
+	sel_settext(&sel.primary, NULL);
+	sel_settext(&sel.clipboard, NULL);
+	if (w->req && --w->req->refs == 0) {
+		free(w->req->buf);
+		free(w->req->v);
+		free(w->req);
 	}
 
-	size_hints->flags = PSize | PBaseSize | PResizeInc;
-	size_hints->width = xw.width;
-	size_hints->height = xw.height;
-	size_hints->base_width = 2 * xw.border;
-	size_hints->base_height = 2 * xw.border;
-	size_hints->width_inc = xw.cw;
-	size_hints->height_inc = xw.ch;
-	
-	/* Set position and gravity elements */
-	if (xw.geomask & (XValue|YValue)) {
-		size_hints->flags |= USPosition | PWinGravity;
-		size_hints->x = xw.x;
-		size_hints->y = xw.y;
-		size_hints->win_gravity = geomask_to_gravity(xw.geomask);
+	for (p = &wins; *p != w; p = &(*p)->next)
+		;
+	*p = w->next;
+	if (f->active == w)
+		f->active = NULL;
+	free(w);
+	mem_add(MEM_SCREEN, -(long)sizeof(*w));
+	win = NULL;
+
+	/* The other panes of the frame take its place */
+	frame_remove(f, l);
+
+	if (!wins && !daemon_mode) {
+		XCloseDisplay(xwdef.display);
+		exit(status);
 	}
+}
 
-	wm_hints->flags = InputHint;
-	wm_hints->input = True;
+/*
+ * Create the frame of a new window, of a single tab holding it.
+ */
+static void frame_new(Win *w)
+{
+	Frame *f;
+
+	if (!(f = w->frame = calloc(1, sizeof(*f))) ||
+			!(f->tab = malloc(sizeof(*f->tab))) ||
+			!(w->layout = f->tab[0] = calloc(1, sizeof(*w->layout))))
+		die("calloc failed: %s", strerror(errno));
+	mem_add(MEM_SCREEN, sizeof(*f) + sizeof(*w->layout));
+
+	w->layout->pane = w;
+	f->ntabs = 1;
+	f->active = w;
+	f->next = frames;
+	frames = f;
+}
 
-	class_hints->res_name = res_name;
-	class_hints->res_class = res_class;
+/*
+ * Find the frame with the given X window.
+ */
+static Frame *frame_find(Window xwin)
+{
+	Frame *f;
 
-	XSetWMNormalHints(xw.display, xw.win, size_hints);
-	XSetWMHints(xw.display, xw.win, wm_hints);
-	XSetClassHint(xw.display, xw.win, class_hints);
+	for (f = frames; f && f->win != xwin; f = f->next)
+		;
+	return f;
+}
 
-	XFree(size_hints);
-	XFree(wm_hints);
-	XFree(class_hints);
+/*
+ * Handle an event of a frame. Returns False for the events its
+ * active pane handles instead: keys, focus and the like.
+ */
+static Bool frame_event(Frame *f, XEvent *event)
+{
+	Win *w, *next;
+
+	switch (event->type) {
+	case ConfigureNotify:
+		if (event->xconfigure.width != f->width ||
+				event->xconfigure.height != f->height) {
+			f->width = event->xconfigure.width;
+			f->height = event->xconfigure.height;
+			frame_apply(f);
+		}
+		return True;
+	case Expose:
+		if (event->xexpose.count == 0)
+			frame_drawtabs(f);
+		return True;
+	case UnmapNotify:
+		/* Panes are not told when they stop being viewable */
+		for (w = wins; w; w = w->next) {
+			if (w->frame != f)
+				continue;
+			win_load(w);
+			xwindow_hide();
+		}
+		return True;
+	case FocusIn:
+	case FocusOut:
+		if (event->xfocus.mode != NotifyGrab)
+			f->focused = (event->type == FocusIn);
+		return False;
+	case ClientMessage:
+		if (event->xclient.message_type == xembed_atom &&
+				event->xclient.format == 32) {
+			if (event->xclient.data.l[1] == XEMBED_FOCUS_IN)
+				f->focused = True;
+			else if (event->xclient.data.l[1] == XEMBED_FOCUS_OUT)
+				f->focused = False;
+			return False;
+		}
+		if (event->xclient.data.l[0] != wmdeletewin_atom)
+			return True;
+		/* Closing the last pane closes the frame */
+		for (w = wins; w; w = next) {
+			next = w->next;
+			if (w->frame != f)
+				continue;
+			win_load(w);
+			if (tty.pid > 0)
+				kill(tty.pid, SIGHUP);
+			win_close(w, EXIT_SUCCESS);
+		}
+		return True;
+	}
+	return False;
 }
 
 /*
- * Load the specified font, and get width & height.
+ * Lay out a tab, or part of it, in the area of the frame at x, y.
+ * Halves of a split get half of it each, less pane_gap.
  */
-static void load_font(XFont *font, char *font_name)
+static void frame_place(Layout *l, int x, int y, int width, int height)
 {
-	XFontStruct **fonts;
-	XFontSetExtents *font_extents;
-	char **missing_charset_list;
-	int missing_charset_count;
-	char *def_string;
-	char **font_name_list;
-	int i;
-	int num_fonts;
-	int ascent, descent;
+	int n;
 
-	/* Try to create font set structure */
-	font->font_set = XCreateFontSet(xw.display, font_name,
-			&missing_charset_list, &missing_charset_count,
-			&def_string);
-	if (!font->font_set) {
-		die("failed to create font set \"%s\"", font_name);
+	l->x = x;
+	l->y = y;
+	l->width = width;
+	l->height = height;
+	if (!l->half[0])
+		return;
+
+	if (l->stacked) {
+		n = MAX((height - pane_gap) / 2, 1);
+		frame_place(l->half[0], x, y, width, n);
+		frame_place(l->half[1], x, y + n + pane_gap, width,
+				MAX(height - n - pane_gap, 1));
+	} else {
+		n = MAX((width - pane_gap) / 2, 1);
+		frame_place(l->half[0], x, y, n, height);
+		frame_place(l->half[1], x + n + pane_gap, y,
+				MAX(width - n - pane_gap, 1), height);
 	}
-	for (i = 0; i < missing_charset_count; i++) {
-		debug(D_WARN, "font for charset \"%s\" missing",
-				missing_charset_list[i]);
+}
+
+/*
+ * Lay out the current tab of a frame below the tab bar, and show
+ * its panes only. Panes that change size are resized by the
+ * ConfigureNotify events that follow.
+ */
+static void frame_apply(Frame *f)
+{
+	int bar = (f->ntabs > 1) ? xwdef.ch : 0;
+	Layout *l;
+	Win *w;
+
+	frame_place(f->tab[f->cur], 0, bar, f->width, MAX(f->height - bar, 1));
+	for (w = wins; w; w = w->next) {
+		if (w->frame != f)
+			continue;
+		win_load(w);
+		l = w->layout;
+		if (layout_root(l) == f->tab[f->cur]) {
+			XMoveResizeWindow(xw.display, xw.win, l->x, l->y, l->width, l->height);
+			XMapWindow(xw.display, xw.win);
+		} else {
+			XUnmapWindow(xw.display, xw.win);
+		}
 	}
+	frame_drawtabs(f);
+}
 
-	/* Get font metrics */
-	font_extents = XExtentsOfFontSet(font->font_set);
-	num_fonts = XFontsOfFontSet(font->font_set, &fonts, &font_name_list);
-	for (i = 0, ascent = 0, descent = 0; i < num_fonts; i++, fonts++) {
-		if (ascent < (*fonts)->ascent)
-			ascent = (*fonts)->ascent;
-		if (descent < (*fonts)->descent)
-			descent = (*fonts)->descent;
+/*
+ * Draw the tab bar of a frame, the current tab in reverse.
+ */
+static void frame_drawtabs(Frame *f)
+{
+	char label[16];
+	int i, x, len;
+
+	if (f->ntabs < 2)
+		return;
+
+	XSetForeground(xwdef.display, dc.gc, dc.colors[color_bg].pixel);
+	XFillRectangle(xwdef.display, f->win, dc.gc, 0, 0, f->width, xwdef.ch);
+	for (i = 0, x = 0; i < f->ntabs; i++, x += len * xwdef.cw) {
+		len = snprintf(label, sizeof(label), " %d ", i + 1);
+		if (i == f->cur) {
+			XSetForeground(xwdef.display, dc.gc, dc.colors[color_fg].pixel);
+			XFillRectangle(xwdef.display, f->win, dc.gc, x, 0,
+					len * xwdef.cw, xwdef.ch);
+		}
+		XSetForeground(xwdef.display, dc.gc,
+				dc.colors[(i == f->cur) ? color_bg : color_fg].pixel);
+		Xutf8DrawString(xwdef.display, f->win, dc.font.font_set, dc.gc,
+				x, dc.font.ascent, label, len);
 	}
-	font->ascent = ascent;
-	font->descent = descent;
-	font->width = font_extents->max_logical_extent.width;
-	font->height = font_extents->max_logical_extent.height;
+}
 
-	xw.cw = font->width;
-	xw.ch = font->height;
+/*
+ * Make a pane the one keys are typed into, giving it the focus
+ * of its frame.
+ */
+static void frame_activate(Win *w)
+{
+	Frame *f = w->frame;
+	Win *old = f->active;
+
+	if (old == w)
+		return;
+	f->active = w;
+
+	if (old) {
+		win_load(old);
+		xw.state &= ~WIN_FOCUSED;
+		XUnsetICFocus(xw.xic);
+	}
+	win_load(w);
+	if (f->focused) {
+		xw.state |= WIN_FOCUSED;
+		clock_gettime(CLOCK_MONOTONIC, &xw.blinktime);
+		XSetICFocus(xw.xic);
+	}
 }
 
-static void load_colors(void)
+/*
+ * Take the place l of a closed pane out of its frame. Its sibling
+ * takes the area of their split, and its tab goes if it was the
+ * only pane. The frame goes with its last pane.
+ */
+static void frame_remove(Frame *f, Layout *l)
 {
-	char *name;
+	Layout *split = l->parent, *next;
+	Frame **p;
 	int i;
-	
-	/* Load colors [0-15] */
-	for (i = 0; i < 16; i++) {
-		/* Use resource color, if set */
-		name = DEFAULT(xres.colors[i], color_names[i]);
-
-		if (!XAllocNamedColor(xw.display, xw.colormap, name,
-					&dc.colors[i], &dc.colors[i]))
-			die("Failed to allocate color \"%s\"", name);
-	}
-	/* Load xterm colors [16-231] */
-	for (i = 16; i < 232; i++) {
-		// TODO
-		dc.colors[i].red = 0;
-		dc.colors[i].green = 0;
-		dc.colors[i].blue = 0;
-		if (!XAllocColor(xw.display, xw.colormap, &dc.colors[i]))
-			die("Failed to allocate color %d", i);
+
+	if (split) {
+		next = split->half[split->half[0] == l];
+		next->parent = split->parent;
+		*layout_slot(f, split) = next;
+		free(split);
+		mem_add(MEM_SCREEN, -(long)sizeof(*split));
+	} else {
+		for (i = 0; f->tab[i] != l; i++)
+			;
+		memmove(&f->tab[i], &f->tab[i+1], (f->ntabs - i - 1) * sizeof(*f->tab));
+		f->ntabs--;
+		if (f->cur > i || f->cur == f->ntabs)
+			f->cur--;
+		next = f->ntabs ? f->tab[f->cur] : NULL;
 	}
-
-	/* Load xterm (grayscale) colors [232-255] */
-	for (i = 232; i < 256; i++) {
-		dc.colors[i].red = 0x0808 + 0x0a0a*(i - 232);
-		dc.colors[i].blue = dc.colors[i].green = dc.colors[i].red;
-		if (!XAllocColor(xw.display, xw.colormap, &dc.colors[i]))
-			die("Failed to allocate color %d", i);
+	free(l);
+	mem_add(MEM_SCREEN, -(long)sizeof(*l));
+
+	if (f->ntabs == 0) {
+		XDestroyWindow(xwdef.display, f->win);
+		for (p = &frames; *p != f; p = &(*p)->next)
+			;
+		*p = f->next;
+		free(f->tab);
+		free(f);
+		mem_add(MEM_SCREEN, -(long)sizeof(*f));
+		return;
 	}
+
+	frame_apply(f);
+	if (!f->active)
+		frame_activate(layout_first(next)->pane);
 }
 
 /*
- * Clear region of the window (column,row coordinates).
+ * Pointer to l where its split or frame holds it.
  */
-static void xwindow_clear(int col1, int row1, int col2, int row2)
+static Layout **layout_slot(Frame *f, Layout *l)
 {
-	XSetForeground(xw.display, dc.gc, dc.colors[color_bg].pixel);
-	XFillRectangle(xw.display, xw.drawbuf, dc.gc,
-			xw.border + col1 * xw.cw,
-			xw.border + row1 * xw.ch,
-			(col2-col1+1) * xw.cw,
-			(row2-row1+1) * xw.ch);
+	int i;
+
+	if (l->parent)
+		return &l->parent->half[l->parent->half[1] == l];
+	for (i = 0; f->tab[i] != l; i++)
+		;
+	return &f->tab[i];
 }
 
 /*
- * Clear region of the window (absolute x,y coordinates).
+ * Layout of the whole tab l is in.
  */
-static void xwindow_abs_clear(int x1, int y1, int x2, int y2)
+static Layout *layout_root(Layout *l)
 {
-	XSetForeground(xw.display, dc.gc, dc.colors[color_bg].pixel);
-	XFillRectangle(xw.display, xw.drawbuf, dc.gc, x1, y1, x2-x1, y2-y1);
+	while (l->parent)
+		l = l->parent;
+	return l;
 }
 
 /*
- * Resize X window.
+ * First pane of a layout, top left.
  */
-static void xwindow_resize(int cols, int rows)
+static Layout *layout_first(Layout *l)
 {
-	/* Update drawbuf to new dimensions */
-	XFreePixmap(xw.display, xw.drawbuf);
-	xw.drawbuf = XCreatePixmap(xw.display, xw.win, xw.width, xw.height,
-			DefaultDepth(xw.display, xw.screen));
-
-	xwindow_abs_clear(0, 0, xw.width, xw.height);
+	while (l->half[0])
+		l = l->half[0];
+	return l;
 }
 
 /*
- * Resize terminal and X window.
+ * Open a pane in the frame of the loaded window: in a new tab, or in
+ * the second half of the loaded pane, split side by side or stacked.
+ * Its shell starts in the directory and environment of the loaded
+ * pane's command.
  */
-static void resize_all(int width, int height)
+static void pane_open(Bool tab, Bool stacked)
 {
-	int cols, rows;
-
-	if (width != 0)
-		xw.width = width;
-	if (height != 0)
-		xw.height = height;
+	WinOpts opts = { .parent = None };
+	Request *req = win->req;
+	Frame *f = win->frame;
+	Layout *l = win->layout, *leaf, *split;
+	char path[32], cwd[PATH_MAX];
+	ssize_t n;
+	int bar;
+
+	snprintf(path, sizeof(path), "/proc/%d/cwd", tty.pid);
+	if (tty.pid > 0 && (n = readlink(path, cwd, sizeof(cwd) - 1)) > 0) {
+		cwd[n] = '\0';
+		opts.cwd = cwd;
+	}
+	opts.env = tty.env;
 
-	cols = (xw.width - 2* xw.border) / xw.cw;
-	rows = (xw.height - 2 * xw.border) / xw.ch;
+	if (!(leaf = calloc(1, sizeof(*leaf))))
+		die("calloc failed: %s", strerror(errno));
+	mem_add(MEM_SCREEN, sizeof(*leaf));
 
-	/* Resize term (internal), X window, and tty */
-	term_resize(cols, rows);
-	xwindow_resize(cols, rows);
-	tty_resize(cols, rows);
+	if (tab) {
+		if (!(f->tab = realloc(f->tab, (f->ntabs + 1) * sizeof(*f->tab))))
+			die("realloc failed: %s", strerror(errno));
+		f->tab[f->ntabs] = leaf;
+		f->cur = f->ntabs++;
+	} else {
+		if (!(split = calloc(1, sizeof(*split))))
+			die("calloc failed: %s", strerror(errno));
+		mem_add(MEM_SCREEN, sizeof(*split));
+		split->stacked = stacked;
+		split->parent = l->parent;
+		*layout_slot(f, l) = split;
+		split->half[0] = l;
+		split->half[1] = leaf;
+		l->parent = leaf->parent = split;
+	}
 
-	DEBUG("Window resized: width = %d, height = %d, cols=%d, rows=%d",
-			xw.width, xw.height, cols, rows);
+	/* Place the new pane, to give its command the right size */
+	bar = (f->ntabs > 1) ? xwdef.ch : 0;
+	frame_place(f->tab[f->cur], 0, bar, f->width, MAX(f->height - bar, 1));
+
+	opts.frame = f;
+	opts.layout = leaf;
+	win_new(&opts);
+	/* The environment lives in the request, shared with the new pane */
+	if ((win->req = req))
+		req->refs++;
+	/* Only the fork used it */
+	tty.cwd = NULL;
+	xwindow_map();
+
+	frame_apply(f);
+	frame_activate(leaf->pane);
 }
 
 /*
- * Convert a geometry mask to a gravity.
+ * Type into the nearest pane of the current tab in the direction
+ * dx, dy, among those level with the loaded pane.
  */
-static int geomask_to_gravity(int mask)
+static void pane_move(int dx, int dy)
 {
-	switch (mask & (XNegative|YNegative)) {
-	case 0:
-		return NorthWestGravity;
-	case XNegative:
-		return NorthEastGravity;
-	case YNegative:
-		return SouthWestGravity;
+	Frame *f = win->frame;
+	Layout *l = win->layout, *c;
+	Win *w, *best = NULL;
+	int d, bestd = INT_MAX;
+
+	for (w = wins; w; w = w->next) {
+		c = w->layout;
+		if (w->frame != f || w == win || layout_root(c) != f->tab[f->cur])
+			continue;
+		if (dx) {
+			if (c->y >= l->y + l->height || c->y + c->height <= l->y)
+				continue;
+			d = (dx > 0) ? c->x - (l->x + l->width) : l->x - (c->x + c->width);
+		} else {
+			if (c->x >= l->x + l->width || c->x + c->width <= l->x)
+				continue;
+			d = (dy > 0) ? c->y - (l->y + l->height) : l->y - (c->y + c->height);
+		}
+		if (d >= 0 && d < bestd) {
+			best = w;
+			bestd = d;
+		}
 	}
-	return SouthEastGravity;
+	if (best)
+		frame_activate(best);
 }
 
 /*
- * Initialize all X related items.
+ * Show the tab n after the current one (before it if negative).
  */
-static void x_init(void)
+static void tab_switch(int n)
 {
-	XrmDatabase serverDB;
-	XGCValues gcvalues;
-	pid_t pid = getpid();
-	char *s;
-	Atom netwmpid_atom;
-
-	/* Open connection to X server */
-	if (!(xw.display = XOpenDisplay(xw.display_name)))
-		die("Cannot open X display \"%s\"", XDisplayName(xw.display_name));
+	Frame *f = win->frame;
 
-	/* Get default screen and visual */
-	xw.screen = XDefaultScreen(xw.display);
-	xw.visual = XDefaultVisual(xw.display, xw.screen);
+	if (f->ntabs < 2)
+		return;
+	f->cur = ((f->cur + n) % f->ntabs + f->ntabs) % f->ntabs;
+	frame_apply(f);
+	frame_activate(layout_first(f->tab[f->cur])->pane);
+}
 
-	/* Initialize rDB resources database */
-	XrmInitialize();
-	/* Get the resources from the server, if any */
-	if ((s = XResourceManagerString(xw.display)) != NULL) {
-		serverDB = XrmGetStringDatabase(s);
-		XrmMergeDatabases(serverDB, &rDB);
+/*
+ * Reap exited children, closing the windows of exited commands.
+ */
+static void reap(void)
+{
+	int status;
+	pid_t pid;
+	Win *w;
+
+	while ((pid = waitpid(-1, &status, WNOHANG)) > 0) {
+		for (w = wins; w; w = w->next) {
+			win_load(w);
+			if (tty.pid == pid)
+				break;
+		}
+		/* Helper process */
+		if (!w)
+			continue;
 
-		memset(&xres, 0, sizeof(xres));
-		/* Get all resources from database */
-		extract_resources();
+		if (WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS) {
+			win_close(w, EXIT_SUCCESS);
+		} else {
+			debug(D_WARN, "child exited with status %d", status);
+			win_close(w, EXIT_FAILURE);
+		}
 	}
+}
 
-	/* Load font, in order:
-	 * 1. Resource database
-	 * 2. Commandline
-	 * 3. Default
-	 */
-	dc.font.name = DEFAULT(xres.font.name, DEFAULT(dc.font.name, DEFAULT_FONT));
-	load_font(&dc.font, dc.font.name);
+/*
+ * Parse the per-window option at arg. Return the last argument
+ * used by the option, or NULL if it is not a valid window option.
+ */
+static char **parse_winopt(char **arg, WinOpts *opts)
+{
+	if (!arg[1])
+		return NULL;
+
+	if (strcmp(*arg, "-g") == 0)
+		opts->geometry = *++arg;
+	else if (strcmp(*arg, "-w") == 0)
+		opts->parent = strtol(*++arg, NULL, 0);
+	else if (strcmp(*arg, "-e") == 0)
+		opts->cmd = ++arg; // All remaining args are part of command
+	else
+		return NULL;
+
+	return arg;
+}
 
-	DEBUG("font width = %d", xw.cw);
-	DEBUG("font height = %d", xw.ch);
+/*
+ * Start listening for termc requests.
+ */
+static void daemon_init(void)
+{
+	struct sockaddr_un addr = { .sun_family = AF_UNIX };
+	mode_t mask;
+	int fd;
 
-	/* Colors */
-	xw.colormap = XDefaultColormap(xw.display, xw.screen);
-	load_colors();
+	if (socket_path(addr.sun_path, sizeof(addr.sun_path), 1) < 0)
+		die("socket directory \"%s\": %s", addr.sun_path, strerror(errno));
 
-	/* Window geometry */
-	xw.width = term.cols * xw.cw + 2 * xw.border;
-	xw.height = term.rows * xw.ch + 2 * xw.border;
-	/* Convert negative coordinates to absolute */
-	if (xw.geomask & XNegative)
-		xw.x += DisplayWidth(xw.display, xw.screen) - xw.width;
-	if (xw.geomask & YNegative)
-		xw.y += DisplayHeight(xw.display, xw.screen) - xw.height;
+	if ((sock_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0)) < 0)
+		die("socket failed: %s", strerror(errno));
 
-	/* Window attributes */
-	xw.attrs.background_pixel = BlackPixel(xw.display, xw.screen);
-	xw.attrs.border_pixel = BlackPixel(xw.display, xw.screen);
-	xw.attrs.colormap = xw.colormap;
-	xw.attrs.bit_gravity = NorthWestGravity;
-	xw.attrs.event_mask = ExposureMask | KeyPressMask | ButtonReleaseMask |
-		StructureNotifyMask | VisibilityChangeMask | FocusChangeMask;
+	/* Replace the socket of a dead daemon, but not a live one */
+	if ((fd = socket(AF_UNIX, SOCK_STREAM, 0)) >= 0) {
+		if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) == 0)
+			die("daemon already listening on \"%s\"", addr.sun_path);
+		close(fd);
+	}
+	unlink(addr.sun_path);
+
+	/* Only the socket is private, not what the shells create */
+	mask = umask(077);
+	if (bind(sock_fd, (struct sockaddr *)&addr, sizeof(addr)) < 0)
+		die("bind to \"%s\" failed: %s", addr.sun_path, strerror(errno));
+	umask(mask);
+	if (listen(sock_fd, SOMAXCONN) < 0)
+		die("listen failed: %s", strerror(errno));
+	loop_watch(sock_fd, &sock_fd);
+}
 
-	xw.parent = DEFAULT(xw.parent, XRootWindow(xw.display, xw.screen));
+/*
+ * Accept a termc client. Its request is read as it comes in, so that
+ * a slow client doesn't hold up the windows.
+ */
+static void daemon_accept(void)
+{
+	Client *c;
+	int fd;
 
-	xw.win = XCreateWindow(xw.display, xw.parent,
-			xw.x, xw.y, xw.width, xw.height, 0,
-			XDefaultDepth(xw.display, xw.screen), InputOutput,
-			xw.visual, CWBackPixel | CWBorderPixel | CWBitGravity
-			| CWEventMask | CWColormap, &xw.attrs);
+	if ((fd = accept4(sock_fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC)) < 0) {
+		debug(D_WARN, "accept failed: %s", strerror(errno));
+		return;
+	}
+	/* Windows are only opened for our own user */
+	if (socket_peer(fd) != getuid()) {
+		debug(D_WARN, "refused a client of another user");
+		close(fd);
+		return;
+	}
 
-	/* Window drawing buffer */
-	xw.drawbuf = XCreatePixmap(xw.display, xw.win, xw.width, xw.height,
-			DefaultDepth(xw.display, xw.screen));
+	if (!(c = calloc(1, sizeof(*c))))
+		die("calloc failed: %s", strerror(errno));
+	c->fd = fd;
+	clock_gettime(CLOCK_MONOTONIC, &c->start);
+	c->next = clients;
+	clients = c;
+	loop_watch(fd, c);
+}
 
-	/* Graphics context */
-	memset(&gcvalues, 0, sizeof(gcvalues));
-	gcvalues.graphics_exposures = False;
-	dc.gc = XCreateGC(xw.display, XRootWindow(xw.display, xw.screen),
-			GCGraphicsExposures, &gcvalues);
-	/* Fill buffer with background color */
-	XSetForeground(xw.display, dc.gc, dc.colors[color_bg].pixel);
-	XFillRectangle(xw.display, xw.drawbuf, dc.gc, 0, 0, xw.width, xw.height);
+/*
+ * Read what a client sent. The request is complete when it
+ * shuts down its end of the socket.
+ */
+static void client_read(Client *c)
+{
+	const char *err;
+	ssize_t r;
 
-	/* Input method(s) and input context */
-	XSetLocaleModifiers("");
-	if (!( xw.xim = XOpenIM(xw.display, rDB, res_name, res_class))) {
-		XSetLocaleModifiers("@im=local");
-		if (!( xw.xim = XOpenIM(xw.display, rDB, res_name, res_class))) {
-			XSetLocaleModifiers("@im=");
-			if (!( xw.xim = XOpenIM(xw.display, rDB, res_name, res_class)))
-				die("could not open input device");
+	do {
+		if (c->len + 1 >= c->size) {
+			c->size = c->size ? 2 * c->size : BUFSIZ;
+			if (!(c->buf = realloc(c->buf, c->size)))
+				die("realloc failed: %s", strerror(errno));
 		}
+		r = read(c->fd, c->buf + c->len, c->size - c->len - 1);
+		if (r > 0)
+			c->len += r;
+	} while (r > 0);
+
+	if (r < 0 && errno == EAGAIN)
+		return;
+	if (r < 0) {
+		debug(D_WARN, "reading request failed: %s", strerror(errno));
+		client_close(c, "");
+		return;
 	}
-	xw.xic = XCreateIC(xw.xim, XNInputStyle, XIMPreeditNothing | XIMStatusNothing,
-			XNClientWindow, xw.win, XNFocusWindow, xw.win, NULL);
-	if (!xw.xic)
-		die("could not create input context");
+	c->buf[c->len] = '\0';
+	err = daemon_open(c->buf, c->len);
+	/* The window keeps the request */
+	if (!*err)
+		c->buf = NULL;
+	client_close(c, err);
+}
 
-	/* Get atom(s) */
-	wmdeletewin_atom = XInternAtom(xw.display, "WM_DELETE_WINDOW", False);
-	netwmpid_atom = XInternAtom(xw.display, "_NET_WM_PID", False);
-	xembed_atom = XInternAtom(xw.display, "_XEMBED", False);
-	timestamp_atom = XInternAtom(xw.display, "TIMESTAMP", False);
-	targets_atom = XInternAtom(xw.display, "TARGETS", False);
-	text_atom = XInternAtom(xw.display, "TEXT", False);
-	clipboard_atom = XInternAtom(xw.display, "CLIPBOARD", False);
-	utf8_atom = XInternAtom(xw.display, "UTF8_STRING", True);
-	if (utf8_atom == None)
-		utf8_atom = XA_STRING;
-
-	XSetWMProtocols(xw.display, xw.win, &wmdeletewin_atom, 1);
-	XChangeProperty(xw.display, xw.win, netwmpid_atom, XA_CARDINAL, 32,
-			PropModeReplace, (uchar *)&(pid), 1);
+/*
+ * Reply to a client, and let it go. An empty reply means
+ * the window was opened.
+ */
+static void client_close(Client *c, const char *err)
+{
+	Client **p;
+
+	if (*err && swrite(c->fd, err, strlen(err)) < 0)
+		debug(D_WARN, "reply to client failed: %s", strerror(errno));
+	loop_unwatch(c->fd);
+	close(c->fd);
+
+	for (p = &clients; *p != c; p = &(*p)->next)
+		;
+	*p = c->next;
+	free(c->buf);
+	free(c);
+}
 
-	/* (Re)set window title */
-	set_title("term");
+/*
+ * Open the window of a termc request, which consists of NUL terminated
+ * strings: the working directory, the number of arguments in decimal,
+ * the arguments, then the environment up to the end of the request.
+ * The window keeps req if it is opened. Returns an error message,
+ * or "".
+ */
+static const char *daemon_open(char *req, size_t len)
+{
+	char **reqv, **arg, **next, *count, *end;
+	size_t i, n, k;
+	long argc;
+	WinOpts opts;
+
+	for (i = 0, n = 0; i < len; i += strlen(req + i) + 1)
+		n++;
+	if (n < 2 || !*req)
+		return "malformed request";
+	count = req + strlen(req) + 1;
+	argc = strtol(count, &end, 10);
+	if (end == count || *end || argc < 0 || argc > n - 2)
+		return "malformed request";
+
+	/* The arguments and the environment each end with NULL */
+	if (!(reqv = calloc(n + 2, sizeof(*reqv))))
+		die("calloc failed: %s", strerror(errno));
+	reqv[0] = req;
+	for (i = end + 1 - req, k = 1; i < len; i += strlen(req + i) + 1, k++) {
+		if (k == argc + 1)
+			k++;
+		reqv[k] = req + i;
+	}
 
-	/* Map window and set hints */
-	XMapWindow(xw.display, xw.win);
-	set_hints();
+	memset(&opts, 0, sizeof(opts));
+	opts.cwd = reqv[0];
 
-	XSync(xw.display, False);
+	/* Arguments */
+	for (arg = reqv + 1; *arg; arg++) {
+		if (*arg[0] != '-') // Not an option
+			continue;
+		if (!(next = parse_winopt(arg, &opts))) {
+			free(reqv);
+			return "unknown option";
+		}
+		arg = next;
+		if (opts.cmd)
+			break;
+	}
+	opts.env = reqv + argc + 2;
+
+	win_new(&opts);
+	xwindow_map();
+	if (!(win->req = malloc(sizeof(*win->req))))
+		die("malloc failed: %s", strerror(errno));
+	*win->req = (Request){ .buf = req, .v = reqv, .refs = 1 };
+	return "";
 }
 
 /*
@@ -1218,7 +6592,6 @@ static char *get_resource(char *name, char *class)
 static void extract_resources(void)
 {
 	char *s, color_name[16], color_class[16];
-	uint cols, rows;
 	int i;
 
 	/* Resources that cannot be applied immediately */
@@ -1245,16 +6618,27 @@ static void extract_resources(void)
 		xw.border = atoi(s);
 	}
 
-	/* Geometry resource */
+	/* Geometry resource (applied to each new window) */
 	if ((s = get_resource("geometry", "Geometry")) != NULL) {
-		xw.geomask = XParseGeometry(s, &xw.x, &xw.y, &cols, &rows);
-		term_resize(cols, rows);
+		xres.geometry = strdup(s);
 	}
 }
 
 static void term_reset(void)
 {
 	term.cursor = (Coord){ .x = 0, .y = 0 };
+	term.cursorstyle = 0;
+	term.modkeys = 0;
+	term.mode &= ~(MODE_HIDE | MODE_APPCURSOR | MODE_APPKEYPAD | MODE_MOUSE |
+			MODE_MOUSESGR);
+	/* Stop selecting pointer motion, once the window exists */
+	if (xw.win)
+		mouse_select();
+	term.pen = (Style){ .fg = color_fg, .bg = color_bg, .attr = 0 };
+	term_setpen();
+	term.esc = ESC_NONE;
+	term.top = 0;
+	term.bot = term.rows - 1;
 	term_clear(0, 0, term.cols-1, term.rows-1);
 }
 
@@ -1265,88 +6649,313 @@ static void term_init(int cols, int rows)
 {
 	/* Set initial size, and force allocation
 	 * of internal structures. */
+	int n = MAX(history_size, 1);
+
+	term.freecluster = -1;
+	term.hist = calloc(n, sizeof(*term.hist));
+	mem_add(MEM_HISTORY, n * sizeof(*term.hist));
+
+	/* Style table, with the default style pinned at 0 */
+	term.freestyle = -1;
+	style_grow();
+	term.pen = (Style){ .fg = color_fg, .bg = color_bg, .attr = 0 };
+	term.penidx = style_intern(&term.pen);
+
 	term_resize(cols, rows);
 	term_reset();
 }
 
 /*
- * Main loop of terminal.
- * TODO
+ * Free internal structures of Term.
  */
-void main_loop(void)
+static void term_free(void)
 {
-	XEvent event;
-	int width = xw.width;
-	int height = xw.height;
-	fd_set read_fds;
-	//struct timespec *tv = NULL; // Block indefinitely
-	struct timespec tv; // FIXME
+	int i, n = MAX(history_size, 1);
 
-	/* Wait for window to be mapped */
-	while (1) {
-		XNextEvent(xw.display, &event);
+	for (i = 0; i < term.rows; i++) {
+		free(term.line[i]);
+		free(term.style[i]);
+		mem_add(MEM_HINTS, -term.lm[i].size * (long)sizeof(Match));
+		free(term.lm[i].match);
+	}
+	free(term.line);
+	free(term.style);
+	free(term.dirty);
+	free(term.drawn);
+	free(term.lm);
+	mem_add(MEM_SCREEN, -term_screensize(term.cols, term.rows));
+	for (i = 0; i < history_size; i++) {
+		mem_add(MEM_HISTORY, -term.hist[i].len * CELL_SIZE);
+		free(term.hist[i].line);
+		free(term.hist[i].style);
+	}
+	free(term.hist);
+	mem_add(MEM_HISTORY, -n * (long)sizeof(*term.hist));
+	mem_add(MEM_PARSER, -(long)term.osc.size);
+	free(term.osc.data);
+	export_stop();
+	spill_free();
+	free(term.cluster);
+	free(term.styles);
+	free(term.stylehash);
+	mem_add(MEM_SCREEN, -(term.ncluster * (long)sizeof(*term.cluster) +
+			term.nstyles * (long)(sizeof(*term.styles) + sizeof(*term.stylehash))));
+}
 
-		if (XFilterEvent(&event, None))
-			continue;
-		if (event.type == ConfigureNotify) {
-			/* Get size of mapped window */
-			width = event.xconfigure.width;
-			height = event.xconfigure.height;
-		} else if (event.type == MapNotify) {
-			break;
-		}
+/*
+ * Make the wait of main_loop() last wait ms at most.
+ */
+static void loop_timeout(struct timespec **tv, struct timespec *ts, double wait)
+{
+	wait = MAX(wait, 0);
+	if (*tv && wait >= (*tv)->tv_sec * 1E3 + (*tv)->tv_nsec / 1E6)
+		return;
+	ts->tv_sec = wait / 1E3;
+	ts->tv_nsec = (wait - ts->tv_sec * 1E3) * 1E6;
+	*tv = ts;
+}
 
+/*
+ * Set up the event loop: an epoll instance watching the X connection,
+ * a signalfd for SIGCHLD, SIGUSR1 and the signals ending a trace, and
+ * a timerfd for deadlines. The tty of each window and the termd socket
+ * are added as they are opened.
+ */
+static void loop_init(void)
+{
+	sigset_t mask;
+
+	/* SIGCHLD and SIGUSR1 (report memory) are only ever read from signal_fd */
+	sigemptyset(&mask);
+	sigaddset(&mask, SIGCHLD);
+	sigaddset(&mask, SIGUSR1);
+	/* and so are the signals ending a -T trace, to write it first */
+	if (trace_path) {
+		sigaddset(&mask, SIGINT);
+		sigaddset(&mask, SIGTERM);
+		sigaddset(&mask, SIGHUP);
 	}
-	resize_all(width, height);
+	sigprocmask(SIG_BLOCK, &mask, NULL);
+
+	if ((loop_fd = epoll_create1(EPOLL_CLOEXEC)) < 0)
+		die("epoll_create1 failed: %s", strerror(errno));
+	if ((signal_fd = signalfd(-1, &mask, SFD_NONBLOCK | SFD_CLOEXEC)) < 0)
+		die("signalfd failed: %s", strerror(errno));
+	if ((timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC)) < 0)
+		die("timerfd_create failed: %s", strerror(errno));
+
+	x_fd = XConnectionNumber(xwdef.display);
+	loop_watch(x_fd, &x_fd);
+	loop_watch(signal_fd, &signal_fd);
+	loop_watch(timer_fd, &timer_fd);
+}
 
-	/* Set up tty and exec command */
-	tty_init();
+/*
+ * Wake up main_loop() when fd becomes readable. ptr identifies the fd:
+ * the window whose tty it is, or the variable holding it.
+ */
+static void loop_watch(int fd, void *ptr)
+{
+	struct epoll_event ev = { .events = EPOLLIN, .data.ptr = ptr };
+
+	if (epoll_ctl(loop_fd, EPOLL_CTL_ADD, fd, &ev) < 0)
+		die("epoll_ctl failed: %s", strerror(errno));
+}
+
+/*
+ * Wake up main_loop() when fd becomes writable. Returns False if fd
+ * can't be watched, like a regular file, which never blocks.
+ */
+static Bool loop_watch_write(int fd, void *ptr)
+{
+	struct epoll_event ev = { .events = EPOLLOUT, .data.ptr = ptr };
 
-	/* XXX DEBUG XXX */
-	DEBUG("width = %d", width);
-	DEBUG("height = %d", height);
-	DEBUG("cols = %d", term.cols);
-	DEBUG("rows = %d", term.rows);
+	if (epoll_ctl(loop_fd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+		if (errno != EPERM)
+			die("epoll_ctl failed: %s", strerror(errno));
+		return False;
+	}
+	return True;
+}
 
-	XSetForeground(xw.display, dc.gc, dc.colors[color_fg].pixel);
+/*
+ * Stop watching fd, before it is closed. Copies of the fd left in
+ * child processes would otherwise keep it in the epoll set.
+ */
+static void loop_unwatch(int fd)
+{
+	epoll_ctl(loop_fd, EPOLL_CTL_DEL, fd, NULL);
+}
 
-	//sleep(1);
+/*
+ * Main loop of terminal. Sleeps until an fd is readable or the earliest
+ * deadline of the windows passes, and never wakes up on a fixed tick.
+ */
+void main_loop(void)
+{
+	XEvent event;
+	Win *w, *next;
+	Frame *f;
+	Client *c, *cnext;
+	struct epoll_event events[32];
+	struct signalfd_siginfo si;
+	struct itimerspec its = { { 0, 0 }, { 0, 0 } };
+	struct timespec now, timeout, *tv;
+	Bool pending, reaping, accepting;
+	uint64_t expirations;
+	double wait;
+	uint64_t start;
+	int i, n;
 
 	while (1) {
-		/* Reset file descriptor set */
-		FD_ZERO(&read_fds);
-		FD_SET(tty.fd, &read_fds);
+		/* Process all pending events */
+		while (XPending(xwdef.display)) {
+			XNextEvent(xwdef.display, &event);
+
+			if (XFilterEvent(&event, None))
+				continue;
+			/* Events of a frame are its own, or its active pane's */
+			if ((f = frame_find(event.xany.window))) {
+				if (frame_event(f, &event))
+					continue;
+				w = f->active;
+			} else if (!(w = win_find(event.xany.window))) {
+				continue;
+			}
+			win_load(w);
+			/* The server is done reading the shared memory image */
+			if (atlas.cov && event.type == dc.shmevent) {
+				xw.shmpending--;
+				continue;
+			}
+			/* Search event handlers for event type */
+			if (event.type < LASTEvent && event_handler[event.type]) {
+				start = trace_now();
+				(event_handler[event.type])(&event);
+				trace_span("X event", start, "type", event.type);
+			}
+		}
 
-		tv.tv_sec = 1;
-		tv.tv_nsec = 0;
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		for (w = wins; w; w = w->next) {
+			win_load(w);
+			mouse_flush();
+			/* Hand the buffer of a long hidden window back to the server */
+			if (!(xw.state & WIN_VISIBLE)) {
+				if ((xw.shmimg || xw.drawbuf) && !xw.shmpending &&
+						TIMEDIFF(now, xw.hidetime) >= release_time)
+					xwindow_release();
+				continue;
+			}
+			/* Hold synchronized output until the frame is complete */
+			if (term.mode & MODE_SYNC) {
+				if (TIMEDIFF(now, term.synctime) < sync_timeout)
+					continue;
+				term.mode &= ~MODE_SYNC;
+			}
+			draw();
+		}
+		start = trace_now();
+		XFlush(xwdef.display);
+		trace_span("XFlush", start, NULL, 0);
 
-		/* Check if fd(s) are ready to be read */
-		if (pselect(tty.fd+1, &read_fds, NULL, NULL, &tv, NULL) < 0) {
-			if (errno == EINTR)
-				continue; // Interrupted
-			die("pselect failed: %s", strerror(errno));
+		if (trace_startup && trace_output) {
+			trace_phase("first frame drawn");
+			trace_startup = False;
 		}
 
-		if (FD_ISSET(tty.fd, &read_fds)) {
-			/* Read from tty device */
-			tty_read();
+		tv = NULL;
+		pending = False;
+		for (w = wins; w; w = w->next) {
+			win_load(w);
+			/* Wake up to draw held output when it times out */
+			if (term.mode & MODE_SYNC)
+				loop_timeout(&tv, &timeout,
+						sync_timeout - TIMEDIFF(now, term.synctime));
+			/* and to release the buffer of a hidden window */
+			if (!(xw.state & WIN_VISIBLE) && (xw.shmimg || xw.drawbuf))
+				loop_timeout(&tv, &timeout,
+						release_time - TIMEDIFF(now, xw.hidetime));
+			/* and to blink the cursor */
+			if ((wait = cursor_wait(&now)) >= 0)
+				loop_timeout(&tv, &timeout, wait);
+			/* Output left over by the parse budget */
+			pending |= tty_pending();
+			/* and an export to a file, which never waits */
+			pending |= term.export && !term.export->polled;
+		}
+		/* Wake up to drop termc clients taking too long */
+		for (c = clients; c; c = c->next)
+			loop_timeout(&tv, &timeout, REQUEST_TIME - TIMEDIFF(now, c->start));
+
+		/* Arm the timer for the earliest deadline; all zero disarms it */
+		its.it_value.tv_sec = tv ? tv->tv_sec : 0;
+		its.it_value.tv_nsec = tv ? MAX(tv->tv_nsec, !tv->tv_sec) : 0;
+		if (timerfd_settime(timer_fd, 0, &its, NULL) < 0)
+			die("timerfd_settime failed: %s", strerror(errno));
+
+		/* Don't sleep on output or X events read in the meantime */
+		n = epoll_wait(loop_fd, events, LEN(events),
+				(pending || XEventsQueued(xwdef.display, QueuedAlready)) ? 0 : -1);
+		if (n < 0) {
+			if (errno != EINTR)
+				die("epoll_wait failed: %s", strerror(errno));
+			n = 0;
 		}
 
-		//XDrawLine(xw.display, xw.win, dc.gc, 0, 0, 20, 20);
+		reaping = accepting = False;
+		for (i = 0; i < n; i++) {
+			if (events[i].data.ptr == &signal_fd) {
+				while (read(signal_fd, &si, sizeof(si)) == sizeof(si)) {
+					if (si.ssi_signo == SIGCHLD)
+						reaping = True;
+					else if (si.ssi_signo == SIGUSR1)
+						mem_report();
+					/* Exit through atexit(), which writes the trace */
+					else
+						exit(128 + si.ssi_signo);
+				}
+			} else if (events[i].data.ptr == &timer_fd) {
+				read(timer_fd, &expirations, sizeof(expirations));
+			} else if (events[i].data.ptr == &sock_fd) {
+				accepting = True;
+			}
+			/* X events are read at the top of the loop */
+		}
 
-		/* Process all pending events */
-		while (XPending(xw.display)) {
-			XNextEvent(xw.display, &event);
+		if (reaping)
+			reap();
+
+		/* Read from the tty devices */
+		for (w = wins; w; w = next) {
+			next = w->next;
+			win_load(w);
+			if (term.export) {
+				for (i = 0; i < n && events[i].data.ptr != term.export; i++)
+					;
+				if (i < n || !term.export->polled)
+					export_write();
+			}
+			for (i = 0; i < n && events[i].data.ptr != w; i++)
+				;
+			if (tty_pollfd() >= 0 && (i < n || tty_pending()))
+				tty_read();
+		}
 
-			if (XFilterEvent(&event, None))
-				continue;
-			/* Search event handlers for event type */
-			if (event_handler[event.type])
-				(event_handler[event.type])(&event);
+		/* Read the requests of termc clients, with one deadline for all of each */
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		for (c = clients; c; c = cnext) {
+			cnext = c->next;
+			for (i = 0; i < n && events[i].data.ptr != c; i++)
+				;
+			if (TIMEDIFF(now, c->start) >= REQUEST_TIME)
+				client_close(c, "request timed out");
+			else if (i < n)
+				client_read(c);
 		}
 
-		draw();
-		XFlush(xw.display);
+		if (accepting)
+			daemon_accept();
 	}
 }
 
@@ -1359,6 +6968,7 @@ static void exec_cmd(void)
 	const struct passwd *pw;
 	char *shell, *prog, **args;
 	char buf[sizeof(long)*8 + 1];
+	sigset_t mask;
 
 	if (!(pw = getpwuid(getuid()))) {
 		die("getpwuid: %s", strerror(errno));
@@ -1369,9 +6979,9 @@ static void exec_cmd(void)
 		shell = config_shell;
 	}
 
-	if (cmd) {
-		prog = *cmd;
-		args = cmd;
+	if (tty.cmd) {
+		prog = *tty.cmd;
+		args = tty.cmd;
 	} else {
 		prog = shell;
 		args = (char *[]) {shell, NULL};
@@ -1379,6 +6989,12 @@ static void exec_cmd(void)
 
 	snprintf(buf, sizeof(buf), "%lu", xw.win);
 
+	/* Run in the directory and environment of the termc client */
+	if (tty.cwd && chdir(tty.cwd) < 0)
+		debug(D_WARN, "chdir to \"%s\" failed: %s", tty.cwd, strerror(errno));
+	if (tty.env)
+		environ = tty.env;
+
 	/* Set up environment */
 	unsetenv("COLUMNS");
 	unsetenv("LINES");
@@ -1395,32 +7011,15 @@ static void exec_cmd(void)
 	signal(SIGINT, SIG_DFL);
 	signal(SIGQUIT, SIG_DFL);
 	signal(SIGTERM, SIG_DFL);
+	signal(SIGPIPE, SIG_DFL);
+	sigemptyset(&mask);
+	sigprocmask(SIG_SETMASK, &mask, NULL);
 
 	if (execvp(prog, args) < 0) {
 		exit(EXIT_FAILURE);
 	}
 }
 
-/*
- * SIGCHLD signal handler.
- */
-void sigchld(int signal)
-{
-	int status;
-
-	if (signal != SIGCHLD)
-		return;
-
-	if (waitpid(tty.pid, &status, 0) < 0)
-		debug(D_WARN, "waiting for pid %hd failed: %s", tty.pid, strerror(errno));
-
-	if (WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS)
-		exit(EXIT_SUCCESS);
-
-	debug(D_WARN, "child exited with status %d", status);
-	exit(EXIT_FAILURE);
-}
-
 /*
  * Initialize pty master and slave.
  */
@@ -1456,9 +7055,12 @@ static void tty_init(void)
 	default:	/* PARENT */
 		/* Close slave */
 		close(slave);
+		/* Don't leak the master into other windows' commands */
+		fcntl(master, F_SETFD, FD_CLOEXEC);
 		tty.fd = master;
 		tty.ws = winp;
-		signal(SIGCHLD, sigchld);
+		if (reader_thread)
+			ring_new(master);
 		break;
 	}
 }
@@ -1472,13 +7074,18 @@ static void usage()
 
 int main(int argc, char *argv[])
 {
-	uint cols = DEFAULT_COLS, rows = DEFAULT_ROWS;
-	char **arg, *p;
+	WinOpts opts = { .parent = None };
+	char **arg, **next, *p;
 	xw.display_name = NULL;
-	xw.parent = None;
 	dc.font.name = NULL;
 
+	clock_gettime(CLOCK_MONOTONIC, &trace_start);
+	trace_last = trace_start;
+
 	argv0 = *argv;
+	/* Run as daemon when invoked as termd */
+	p = strrchr(argv0, '/');
+	daemon_mode = (strcmp(p ? p+1 : argv0, "termd") == 0);
 
 #define OPT(s)  (strcmp(*arg, (s)) == 0)
 #define OPTARG(s) (OPT((s)) && (*(arg+1) ? (arg++, 1) :\
@@ -1500,21 +7107,31 @@ int main(int argc, char *argv[])
 			dc.font.name = *arg;
 		else if (OPTARG("-d"))
 			xw.display_name = *arg;
-		else if (OPTARG("-g"))
-			xw.geomask = XParseGeometry(*arg, &xw.x, &xw.y, &cols, &rows);
-		else if (OPTARG("-w"))
-			xw.parent = strtol(*arg, NULL, 0);
 		else if (OPTARG("-n"))
 			res_name = *arg;
 		else if (OPTARG("-c"))
 			res_class = *argv;
-		else if (OPTARG("-e")) {
-			cmd = arg; // All remaining args are part of command
-			break;
+		else if (OPT("-D"))
+			daemon_mode = True;
+		else if (OPT("-p"))
+			trace_startup = True;
+		else if (OPTARG("-T"))
+			trace_path = *arg;
+		else if (OPT("--mem-report"))
+			mem_atexit = True;
+		else if ((next = parse_winopt(arg, &opts))) {
+			arg = next;
+			if (opts.cmd)
+				break;
 		} else {
 			die("unknown option \"%s\"", *arg);
 		}
 	}
+	main_pid = getpid();
+	if (trace_path)
+		atexit(trace_write);
+	if (mem_atexit)
+		atexit(mem_report);
 	if (!res_name) {
 		res_name = (p = strrchr(argv[0], '/')) ? (p+1) : RES_NAME;
 	}
@@ -1522,9 +7139,24 @@ int main(int argc, char *argv[])
 	/* Set up locale */
 	setlocale(LC_CTYPE, "");
 
-	term_init(cols, rows);
+	/* Writes to exited helper commands must not kill the terminal */
+	signal(SIGPIPE, SIG_IGN);
+
 	x_init();
-	sel_init();
+	loop_init();
+	hint_init();
+	key_init();
+
+	if (daemon_mode) {
+		x_setup();
+		daemon_init();
+	} else {
+		/* Fork the command as soon as the window exists, and
+		 * finish setting up X while it starts */
+		win_new(&opts);
+		x_setup();
+		xwindow_map();
+	}
 
 	main_loop();
 
@@ -11,4 +11,51 @@
 
 #define DEBUG_LEVEL D_WARN
 
+/*
+ * Get the path of the socket termd listens on: $TERMD_SOCKET, or
+ * "socket" in the directory $XDG_RUNTIME_DIR/termd or /tmp/termd-<uid>.
+ * The directory is created if create is set, and must be ours and
+ * private to us, so that no other user can put a socket in its place.
+ * Returns -1 with buf holding the directory on failure.
+ */
+static inline int socket_path(char *buf, size_t len, int create)
+{
+	struct stat st;
+	char *dir;
+
+	if (getenv("TERMD_SOCKET")) {
+		snprintf(buf, len, "%s", getenv("TERMD_SOCKET"));
+		return 0;
+	}
+	if ((dir = getenv("XDG_RUNTIME_DIR")))
+		snprintf(buf, len, "%s/termd", dir);
+	else
+		snprintf(buf, len, "/tmp/termd-%u", (unsigned)getuid());
+
+	if (create && mkdir(buf, 0700) < 0 && errno != EEXIST)
+		return -1;
+	if (lstat(buf, &st) < 0)
+		return -1;
+	if (!S_ISDIR(st.st_mode) || st.st_uid != getuid() || (st.st_mode & 077)) {
+		errno = EPERM;
+		return -1;
+	}
+	snprintf(buf + strlen(buf), len - strlen(buf), "/socket");
+	return 0;
+}
+
+/*
+ * Get the user of the process at the other end of a unix socket,
+ * or -1 if it can't be told.
+ */
+static inline long socket_peer(int fd)
+{
+	struct ucred cred;
+	socklen_t len = sizeof(cred);
+
+	if (getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &cred, &len) < 0)
+		return -1;
+	return cred.uid;
+}
+
 #endif /* _TERM_H_ */
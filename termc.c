@@ -0,0 +1,102 @@
+/* struct ucred */
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <errno.h>
+#include <limits.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+
+#include "term.h"
+
+extern char **environ;
+
+static char *argv0;
+
+static void die(const char *fmt, ...)
+{
+	va_list ap;
+
+	fprintf(stderr, "%s: ", argv0);
+
+	va_start(ap, fmt);
+	vfprintf(stderr, fmt, ap);
+	va_end(ap);
+
+	fprintf(stderr, "\n");
+	exit(EXIT_FAILURE);
+}
+
+/*
+ * Write a NUL terminated string, including the NUL, to fd.
+ */
+static void send_str(int fd, const char *s)
+{
+	size_t len = strlen(s) + 1;
+
+	while (len > 0) {
+		ssize_t r = write(fd, s, len);
+		if (r < 0)
+			die("write to termd failed: %s", strerror(errno));
+		len -= r;
+		s += r;
+	}
+}
+
+/*
+ * Ask termd to open a window. The arguments are those of a term window
+ * (-g, -w, -e); the command runs in our working directory and environment.
+ */
+int main(int argc, char *argv[])
+{
+	struct sockaddr_un addr = { .sun_family = AF_UNIX };
+	char cwd[PATH_MAX], reply[BUFSIZ], count[16];
+	char **p;
+	ssize_t len = 0, r;
+	int fd;
+
+	argv0 = *argv;
+
+	if (socket_path(addr.sun_path, sizeof(addr.sun_path), 0) < 0)
+		die("socket directory \"%s\": %s", addr.sun_path, strerror(errno));
+
+	if ((fd = socket(AF_UNIX, SOCK_STREAM, 0)) < 0)
+		die("socket failed: %s", strerror(errno));
+	if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0)
+		die("cannot connect to termd at \"%s\": %s", addr.sun_path,
+				strerror(errno));
+	/* Our environment is only for a termd of our own */
+	if (socket_peer(fd) != getuid())
+		die("termd at \"%s\" is run by another user", addr.sun_path);
+
+	if (!getcwd(cwd, sizeof(cwd)))
+		strcpy(cwd, "/");
+
+	/* Working directory, number of arguments, arguments, environment.
+	 * The count lets arguments be empty strings. */
+	send_str(fd, cwd);
+	snprintf(count, sizeof(count), "%d", argc - 1);
+	send_str(fd, count);
+	for (p = argv+1; *p; p++)
+		send_str(fd, *p);
+	for (p = environ; *p; p++)
+		send_str(fd, *p);
+	shutdown(fd, SHUT_WR);
+
+	/* An empty reply means the window was opened */
+	while ((r = read(fd, reply + len, sizeof(reply) - len - 1)) > 0)
+		len += r;
+	close(fd);
+
+	if (len > 0) {
+		reply[len] = '\0';
+		die("%s", reply);
+	}
+
+	return 0;
+}